@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/common_types.hpp"
+#include "org/open_power/HardwareIsolation/ChangeJournal/server.hpp"
+
+#include <deque>
+#include <tuple>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace journal
+{
+
+using ChangeJournalInterface =
+    sdbusplus::org::open_power::HardwareIsolation::server::ChangeJournal;
+using ChangeType = ChangeJournalInterface::ChangeType;
+using Generation = uint64_t;
+using Change =
+    std::tuple<Generation, ChangeType, sdbusplus::message::object_path>;
+using Changes = std::tuple<bool, Generation, std::vector<Change>>;
+
+/**
+ * @class ChangeJournal
+ *
+ * @brief Bounded in memory journal of the entries and the events changes
+ *
+ * @details Each change is tagged with the next generation and, the oldest
+ *          change is dropped once the journal is full so that, the clients
+ *          can get only the changes since their last generation or, get to
+ *          know that they need to resync. The generations start from the
+ *          current time so that, those are not reused after the restart.
+ */
+class ChangeJournal : public type::ServerObject<ChangeJournalInterface>
+{
+  public:
+    ChangeJournal() = delete;
+    ChangeJournal(const ChangeJournal&) = delete;
+    ChangeJournal& operator=(const ChangeJournal&) = delete;
+    ChangeJournal(ChangeJournal&&) = delete;
+    ChangeJournal& operator=(ChangeJournal&&) = delete;
+    ~ChangeJournal() = default;
+
+    /**
+     * @brief Constructor to put object onto bus at a dbus path.
+     *
+     * @param[in] bus - Bus to attach to.
+     * @param[in] objPath - Path to attach at.
+     * @param[in] capacity - the maximum number of changes to keep
+     */
+    ChangeJournal(sdbusplus::bus::bus& bus, const std::string& objPath,
+                  const size_t capacity);
+
+    /**
+     * @brief Used to add the given change into the journal
+     *
+     * @param[in] changeType - the change type
+     * @param[in] objPath - the changed object path
+     *
+     * @return NULL
+     */
+    void add(const ChangeType changeType,
+             const sdbusplus::message::object_path& objPath);
+
+    /**
+     * @brief Used to drop all the changes so that, the clients which are
+     *        using the older generation will resync.
+     *
+     * @return NULL
+     *
+     * @note It is used once the objects are restored since, the restored
+     *       objects are not added into the journal.
+     */
+    void resync();
+
+    /**
+     * @brief Implementation for GetChangesSince
+     *
+     * @param[in] generation - the generation to get the changes after
+     *
+     * @return The resync required flag, the latest generation and
+     *         the changes after the given generation
+     */
+    Changes getChangesSince(Generation generation) override;
+
+  private:
+    /**
+     * @brief The maximum number of changes to keep
+     */
+    size_t _capacity;
+
+    /**
+     * @brief The changes in the generation order
+     */
+    std::deque<Change> _changes;
+
+    /**
+     * @brief The latest generation which is dropped from the journal,
+     *        the changes after this generation are available.
+     */
+    Generation _droppedGeneration{0};
+};
+
+} // namespace journal
+} // namespace hw_isolation
@@ -5,7 +5,10 @@
 #include <sdbusplus/server/object.hpp>
 #include <xyz/openbmc_project/Common/error.hpp>
 
+#include <cstdint>
+#include <map>
 #include <string>
+#include <variant>
 #include <vector>
 
 namespace hw_isolation
@@ -24,6 +27,16 @@ using AssociatedObjPat = std::string;
 using AssociationDef =
     std::vector<std::tuple<AsscDefFwdType, AsscDefRevType, AssociatedObjPat>>;
 
+/**
+ * @brief The property value types of the inventory interfaces which are
+ *        read from the InterfacesAdded signal.
+ */
+using InventoryPropertyValue =
+    std::variant<std::string, bool, uint8_t, uint16_t, uint32_t, uint64_t,
+                 int64_t, double, std::vector<uint8_t>>;
+using InventoryInterfaces =
+    std::map<std::string, std::map<std::string, InventoryPropertyValue>>;
+
 namespace CommonError = sdbusplus::xyz::openbmc_project::Common::Error;
 
 constexpr auto ObjectMapperName = "xyz.openbmc_project.ObjectMapper";
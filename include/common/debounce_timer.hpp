@@ -0,0 +1,176 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <sdeventplus/event.hpp>
+#include <sdeventplus/utility/timer.hpp>
+
+#include <chrono>
+#include <functional>
+#include <optional>
+
+namespace hw_isolation
+{
+namespace debounce
+{
+
+using DebounceHandler = std::function<void(void)>;
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Used to hold the debounce counters to tune the quiet period and
+ *        the maximum latency based on the observed trigger pattern.
+ */
+struct DebounceStats
+{
+    /**
+     * @brief The number of triggers coalesced into the last handler call
+     */
+    uint64_t _lastCoalesced{0};
+
+    /**
+     * @brief The maximum number of triggers coalesced into one handler call
+     */
+    uint64_t _maxCoalesced{0};
+
+    /**
+     * @brief The total number of triggers
+     */
+    uint64_t _totalTriggers{0};
+
+    /**
+     * @brief The total number of handler calls
+     */
+    uint64_t _totalFlushes{0};
+
+    /**
+     * @brief The number of handler calls forced by the maximum latency
+     */
+    uint64_t _maxLatencyFlushes{0};
+};
+
+/**
+ * @class DebounceTimer
+ *
+ * @brief Trailing edge debounce on top of one reusable event loop timer.
+ *
+ * @details The handler is called once the triggers are quiet for the given
+ *          quiet period, or once the given maximum latency is elapsed since
+ *          the first pending trigger so, a continuous trigger burst can't
+ *          postpone the handler indefinitely.
+ */
+class DebounceTimer
+{
+  public:
+    DebounceTimer() = delete;
+    DebounceTimer(const DebounceTimer&) = delete;
+    DebounceTimer& operator=(const DebounceTimer&) = delete;
+    DebounceTimer(DebounceTimer&&) = delete;
+    DebounceTimer& operator=(DebounceTimer&&) = delete;
+    ~DebounceTimer() = default;
+
+    /**
+     * @brief Constructor to attach the debounce timer with the event loop
+     *
+     * @param[in] eventLoop - the event loop to attach the timer
+     * @param[in] quietPeriod - the quiet period after the last trigger
+     * @param[in] maxLatency - the maximum delay from the first pending
+     *                         trigger to the handler call
+     * @param[in] handler - the handler to call once debounced
+     */
+    DebounceTimer(const sdeventplus::Event& eventLoop,
+                  std::chrono::milliseconds quietPeriod,
+                  std::chrono::milliseconds maxLatency,
+                  DebounceHandler handler);
+
+    /**
+     * @brief Used to notify the trigger to debounce
+     *
+     * @return NULL
+     */
+    void trigger();
+
+    /**
+     * @brief Used to call the handler immediately if any trigger is pending
+     *
+     * @return NULL
+     */
+    void flush();
+
+    /**
+     * @brief Used to drop the pending triggers without calling the handler
+     *
+     * @return NULL
+     */
+    void cancel();
+
+    /**
+     * @brief Used to know whether any trigger is pending
+     *
+     * @return true if pending else false
+     */
+    bool isPending() const;
+
+    /**
+     * @brief Used to get the debounce counters
+     *
+     * @return The debounce counters
+     */
+    const DebounceStats& getStats() const;
+
+  private:
+    /**
+     * @brief The quiet period after the last trigger
+     */
+    std::chrono::milliseconds _quietPeriod;
+
+    /**
+     * @brief The maximum delay from the first pending trigger
+     */
+    std::chrono::milliseconds _maxLatency;
+
+    /**
+     * @brief The handler to call once debounced
+     */
+    DebounceHandler _handler;
+
+    /**
+     * @brief The reusable timer to call the handler
+     */
+    sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic> _timer;
+
+    /**
+     * @brief The time of the first pending trigger
+     */
+    std::optional<Clock::time_point> _firstPendingTrigger;
+
+    /**
+     * @brief The number of pending triggers
+     */
+    uint64_t _pendingTriggers{0};
+
+    /**
+     * @brief The debounce counters
+     */
+    DebounceStats _stats;
+
+    /**
+     * @brief Callback for the timer expiry
+     *
+     * @return NULL
+     */
+    void onTimerExpired();
+
+    /**
+     * @brief Helper API to call the handler for the pending triggers
+     *
+     * @param[in] byMaxLatency - used to indicate whether the handler
+     *                           call is forced by the maximum latency
+     *
+     * @return NULL
+     */
+    void callHandler(bool byMaxLatency);
+};
+
+} // namespace debounce
+} // namespace hw_isolation
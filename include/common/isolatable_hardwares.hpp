@@ -221,6 +221,44 @@ class IsolatableHWs
         getInventoryPath(const devtree::DevTreePhysPath& physicalPath,
                          bool& persistedCoreEcoMode);
 
+    /**
+     * @brief Used to get the location code of the isolated hardware FRU
+     *
+     * @param[in] physicalPath - The physical path of isolated hardware
+     *
+     * @return The unexpanded location code of the isolated hardware if it
+     *         is FRU otherwise, its parent FRU on success
+     *         Empty optional on failure
+     *
+     * @note It is used to find the isolated hardware which is waiting for
+     *       its inventory since, the inventory items which are under the FRU
+     *       are published with the FRU location code.
+     */
+    std::optional<LocationCode>
+        getFRULocationCode(const devtree::DevTreePhysPath& physicalPath);
+
+    /**
+     * @brief Used to enable or disable the inventory lookup cache
+     *
+     * @param[in] enable - true to enable, false to disable and drop
+     *                     the cached lookups.
+     *
+     * @return NULL
+     *
+     * @note The cache should be enabled only for a bounded pass (for example,
+     *       restore) since, the inventory won't be watched to invalidate
+     *       the cached lookups.
+     */
+    void enableInventoryLookupCache(bool enable);
+
+    /**
+     * @brief Used to get the number of FRU inventory lookups which are
+     *        done on D-Bus while the inventory lookup cache is enabled.
+     *
+     * @return The number of cached FRU inventory lookups
+     */
+    size_t getNumOfCachedFRULookups() const;
+
   private:
     /**
      * @brief Attached bus connection
@@ -232,6 +270,40 @@ class IsolatableHWs
      */
     std::multimap<HW_Details::HwId, HW_Details> _isolatableHWsList;
 
+    /**
+     * @brief Used to indicate whether the inventory lookup cache is enabled
+     */
+    bool _inventoryLookupCacheEnabled{false};
+
+    /**
+     * @brief The inventory paths cache by the unexpanded location code
+     */
+    std::map<LocationCode, std::vector<sdbusplus::message::object_path>>
+        _invPathsByLocCodeCache;
+
+    /**
+     * @brief The child inventory paths cache by the parent inventory path
+     *        and the child interface name
+     */
+    std::map<std::pair<std::string, std::string>,
+             std::vector<sdbusplus::message::object_path>>
+        _childsInvPathsCache;
+
+    /**
+     * @brief Used to get the child inventory paths by using the inventory
+     *        lookup cache if enabled
+     *
+     * @param[in] parentObjPath - The parent object path to get subtrees
+     * @param[in] interfaceName - The child interface name
+     *
+     * @return The list of child inventory path on success
+     *         Empty optional on failure
+     */
+    std::optional<std::vector<sdbusplus::message::object_path>>
+        getChildsInventoryPath(
+            const sdbusplus::message::object_path& parentObjPath,
+            const std::string& interfaceName);
+
     /**
      * @brief Get the HwID based on given ItemInterfaceName or
      *        PhalPdbgClassName.
@@ -113,6 +113,18 @@ DevTreePhysPath
  */
 bool isECOcore(struct pdbg_target* coreTgt);
 
+/**
+ * @brief Used to get the generation of the phal cec device tree and the
+ *        BMC firmware which provides the inventory.
+ *
+ * @details The generation is changed if the BMC firmware or the phal cec
+ *          device tree layout is changed so that, the inventory paths which
+ *          are resolved using the device tree can be reused until that.
+ *
+ * @return The generation stamp, "0" if failed to get
+ */
+uint64_t getDevTreeGeneration();
+
 /**
  * @brief Used to add functions that will use to get to know
  *        whether the given target (aka device tree node) can
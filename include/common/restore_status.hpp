@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/common_types.hpp"
+#include "org/open_power/HardwareIsolation/RestoreStatus/server.hpp"
+
+namespace hw_isolation
+{
+namespace restore_status
+{
+
+using RestoreStatusInterface =
+    sdbusplus::org::open_power::HardwareIsolation::server::RestoreStatus;
+using Phase = RestoreStatusInterface::Phase;
+
+/**
+ * @brief The restore progress D-Bus object which is hosted on the hardware
+ *        isolation D-Bus root object and, updated by the managers while
+ *        restoring their objects.
+ */
+using RestoreStatus = type::ServerObject<RestoreStatusInterface>;
+
+} // namespace restore_status
+} // namespace hw_isolation
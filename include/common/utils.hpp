@@ -7,6 +7,9 @@
 #include <phosphor-logging/elog-errors.hpp>
 
 #include <format>
+#include <functional>
+#include <map>
+#include <set>
 
 namespace hw_isolation
 {
@@ -176,6 +179,26 @@ bool isHwIosolationSettingEnabled(sdbusplus::bus::bus& bus);
 void setEnabledProperty(sdbusplus::bus::bus& bus,
                         const std::string& dbusObjPath, bool enabledPropVal);
 
+/**
+ * @brief Used to set the Enabled property value for the given list of
+ *        dbus object paths in a batch
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] dbusObjPaths - The object paths to set enabled property value
+ * @param[in] enabledPropVal - set the enabled property value
+ *
+ * @return NULL
+ *
+ * @note The hosting services are found by using single mapper call on
+ *       the common parent of the given objects and, the objects which are
+ *       hosted by the inventory manager are updated by using single "Notify"
+ *       call. The objects which are not implemented the enabled property
+ *       are skipped as like setEnabledProperty.
+ */
+void setEnabledProperties(sdbusplus::bus::bus& bus,
+                          const std::vector<std::string>& dbusObjPaths,
+                          bool enabledPropVal);
+
 /**
  * @brief Used to get BMC log object path by using EID (aka PEL ID)
  *
@@ -191,6 +214,45 @@ std::optional<sdbusplus::message::object_path>
     getBMCLogPath(sdbusplus::bus::bus& bus, const uint32_t eid,
                   bool createPELWithError = false);
 
+using BMCLogPathCallback = std::function<void(
+    uint32_t eid, const sdbusplus::message::object_path& bmcLogPath)>;
+
+/**
+ * @brief Used to request BMC log object paths for the given list of EID
+ *        (aka PEL ID) by keeping all the queries in flight at once.
+ *
+ * @param[in] bus - Bus to attach to.
+ * @param[in] eids - The list of EID (aka PEL ID) to get BMC log object path
+ * @param[in] callback - The callback to call with the BMC log object path
+ *                       for each EID. The object path will be empty if the
+ *                       EID is "0" or failed to get the BMC log object path.
+ *
+ * @return The pending calls. The callback won't be called for the pending
+ *         calls once the returned slots are destructed.
+ *
+ * @note The callback is called when the bus is processed for the replies
+ *       and, it might be called before returning for the failures.
+ */
+std::vector<sdbusplus::slot_t>
+    requestBMCLogPaths(sdbusplus::bus::bus& bus, const std::set<uint32_t>& eids,
+                       BMCLogPathCallback callback);
+
+/**
+ * @brief Used to get BMC log object paths for the given list of EID
+ *        (aka PEL ID) by keeping all the queries in flight at once.
+ *
+ * @param[in] eids - The list of EID (aka PEL ID) to get BMC log object path
+ *
+ * @return The BMC log object path for each EID. The object path will be
+ *         empty if the EID is "0" or failed to get the BMC log object path
+ *         within the timeout.
+ *
+ * @note This API uses the private bus connection to wait for the replies
+ *       so, the shared bus is not processed in the middle of the caller.
+ */
+std::map<uint32_t, sdbusplus::message::object_path>
+    getBMCLogPaths(const std::set<uint32_t>& eids);
+
 /**
  * @brief Helper function to get the instance id from the given
  *        D-Bus object path segment.
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/debounce_timer.hpp"
+
+#include <sdeventplus/event.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <set>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace persist
+{
+
+namespace fs = std::filesystem;
+
+using Writer = std::function<void(void)>;
+using WriterId = size_t;
+
+/**
+ * @brief Used to flush the given file or directory into the storage
+ *
+ * @param[in] path - the file or directory path to flush
+ *
+ * @return true on success else false
+ */
+bool syncPath(const fs::path& path);
+
+/**
+ * @brief Used to replace the given file by the given temporary file which
+ *        is fully written and, to make it durable.
+ *
+ * @param[in] tmpPath - the temporary file which contains the new content
+ * @param[in] path - the file to replace
+ *
+ * @return true on success else false
+ *
+ * @note The temporary file is flushed before the rename and, the parent
+ *       directory is flushed after the rename to persist the rename.
+ */
+bool replaceFile(const fs::path& tmpPath, const fs::path& path);
+
+/**
+ * @brief Used to keep the given unreadable file aside instead of overwriting
+ *        it, for example, the file which is written by the newer version
+ *        before the code update rollback.
+ *
+ * @param[in] path - the file to keep aside
+ *
+ * @return The path which the file is kept at on success
+ *         Empty optional on failure
+ *
+ * @note The file is renamed with the ".unsupported" suffix in the same
+ *       directory so, the previously kept file (if any) is replaced.
+ */
+std::optional<fs::path> keepAside(const fs::path& path);
+
+/**
+ * @class WriteBehind
+ *
+ * @brief Used to defer the persisted state writes from the D-Bus handlers
+ *        and the refresh loops.
+ *
+ * @details The writers are marked dirty on update and, all the dirty
+ *          writers are called together once the updates are quiet or
+ *          the maximum latency is elapsed. The repeated updates of the same
+ *          writer are coalesced into one write, and each writer flushes
+ *          its own files.
+ */
+class WriteBehind
+{
+  public:
+    WriteBehind() = delete;
+    WriteBehind(const WriteBehind&) = delete;
+    WriteBehind& operator=(const WriteBehind&) = delete;
+    WriteBehind(WriteBehind&&) = delete;
+    WriteBehind& operator=(WriteBehind&&) = delete;
+    ~WriteBehind() = default;
+
+    /**
+     * @brief Constructor to attach the write-behind with the event loop
+     *
+     * @param[in] eventLoop - the event loop to schedule the writes
+     * @param[in] maxLatency - the maximum delay from the first update
+     *                         to the write
+     */
+    WriteBehind(const sdeventplus::Event& eventLoop,
+                std::chrono::milliseconds maxLatency);
+
+    /**
+     * @brief Used to add the writer which writes the persisted state
+     *
+     * @param[in] writer - the writer to call to write the updates
+     *
+     * @return The writer id to mark dirty
+     */
+    WriterId addWriter(Writer writer);
+
+    /**
+     * @brief Used to notify the given writer has the updates to write
+     *
+     * @param[in] writerId - the writer id to mark dirty
+     *
+     * @return NULL
+     *
+     * @note Nothing will be scheduled once it is shut down.
+     */
+    void markDirty(const WriterId writerId);
+
+    /**
+     * @brief Used to write all the pending updates immediately
+     *
+     * @return NULL
+     */
+    void flush();
+
+    /**
+     * @brief Used to write all the pending updates and, ignore the updates
+     *        after that.
+     *
+     * @return NULL
+     *
+     * @note It is required to call before destroying the persisted objects
+     *       since, the objects can't be removed from the persisted state
+     *       while shutting down.
+     */
+    void shutdown();
+
+  private:
+    /**
+     * @brief The writers
+     */
+    std::vector<Writer> _writers;
+
+    /**
+     * @brief The writers which have the updates to write
+     */
+    std::set<WriterId> _dirtyWriters;
+
+    /**
+     * @brief Indicates whether it is shut down
+     */
+    bool _shutdown{false};
+
+    /**
+     * @brief Used to schedule the writes
+     */
+    debounce::DebounceTimer _writeTimer;
+
+    /**
+     * @brief Helper API to call the dirty writers
+     *
+     * @return NULL
+     */
+    void writeDirty();
+};
+
+} // namespace persist
+} // namespace hw_isolation
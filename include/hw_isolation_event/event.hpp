@@ -4,14 +4,12 @@
 
 #include "common/common_types.hpp"
 
-#include <cereal/access.hpp>
-#include <cereal/cereal.hpp>
-#include <cereal/types/string.hpp>
-#include <cereal/types/tuple.hpp>
-#include <cereal/types/vector.hpp>
 #include <xyz/openbmc_project/Association/Definitions/server.hpp>
 #include <xyz/openbmc_project/Logging/Event/server.hpp>
 
+#include <optional>
+#include <string>
+
 namespace hw_isolation
 {
 namespace event
@@ -26,6 +24,11 @@ using EventMsg = std::string;
 using AssociationDefInterface =
     sdbusplus::xyz::openbmc_project::Association::server::Definitions;
 
+/**
+ * @brief The per event persisted file path which is used before the events
+ *        were persisted in the event store, it is used only to import
+ *        the events.
+ */
 constexpr auto HW_ISOLATION_EVENT_PERSIST_PATH =
     "/var/lib/op-hw-isolation/persistdata/event/hw_status/{}";
 
@@ -58,92 +61,58 @@ class Event : public type::ServerObject<EventInterface, AssociationDefInterface>
      *  @param[in] eventMsg - the message of the event
      *  @param[in] associationDef - the association to hold other dbus
      *                              object path along with event object.
-     *  @param[in] reqDeserialize - Indicates whether need to serialize or
-     *                              deserialize. By default it will serialize.
+     *  @param[in] restoredTimeStamp - the persisted creation time of the
+     *                                 event to restore. By default, the event
+     *                                 is created with the current time.
      */
     Event(sdbusplus::bus::bus& bus, const std::string& objPath,
           const EventId eventId, const EventSeverity eventSeverity,
           const EventMsg& eventMsg, const type::AssociationDef& associationDef,
-          const bool reqDeserialize = false);
+          const std::optional<uint64_t>& restoredTimeStamp = std::nullopt);
 
     /**
-     * @brief Used to serialize Event members.
-     *
-     * @return NULL
+     * @brief Used get the id of the event.
      */
-    void serialize();
+    EventId getEventId() const;
 
     /**
-     * @brief Used to Deserialize Event members.
+     * @brief Used get the hardware inventory path of the event from
+     *        the event associations.
      *
-     * @return NULL
+     * @return The hardware inventory path, empty if not associated
      */
-    void deserialize();
-
-  private:
-    /** @brief Attached bus connection */
-    sdbusplus::bus::bus& _bus;
-
-    /** @brief The id of isolated hardware dbus event */
-    EventId _eventId;
+    std::string getHwInventoryPath() const;
 
     /**
-     * @brief Allow cereal class access to allow save and load functions
-     *        to be private
-     */
-    friend class cereal::access;
-
-    /**
-     * @brief Helper template that is required by Cereal to perform
-     *        serialization.
-     *
-     * @details * TODO: It is a workaround until fix the following issue
-     *            ibm-openbmc/dev/issues/3573.
+     * @brief Used get the BMC error log path of the event from the event
+     *        associations.
      *
-     * @tparam Archive    - Cereal archive type.
-     * @param[in] archive - Reference to Cereal archive.
-     * @param[in] version - Class version that enables handling
-     *                      a serialized data.
-     *
-     * @return NULL
+     * @return The BMC error log path, empty if not associated
      */
-    template <class Archive>
-    void save(Archive& archive, const uint32_t /*version*/) const
-    {
-        archive(message(), severity(), timestamp(), associations());
-    }
+    std::string getBmcErrorLogPath() const;
 
     /**
-     * @brief Helper template that is required by Cereal to perform
-     *        deserialization.
+     * @brief Used to update the event in place if the given details
+     *        are changed.
      *
-     * @details * TODO: It is a workaround until fix the following issue
-     *            ibm-openbmc/dev/issues/3573.
+     * @param[in] eventSeverity - the severity of the event.
+     * @param[in] eventMsg - the message of the event
+     * @param[in] associationDef - the association to hold other dbus
+     *                             object path along with event object.
      *
-     * @tparam Archive    - Cereal archive type (BinaryInputArchive).
-     * @param[in] archive - Reference to Cereal archive.
-     * @param[in] version - Class version that enables handling
-     *                      a deserialized data.
+     * @return true if updated false if nothing is changed.
      *
-     * @return NULL
+     * @note The event timestamp is updated if the event is updated.
      */
-    template <class Archive>
-    void load(Archive& archive, const uint32_t /*version*/)
-    {
-        EventMsg eventMsg;
-        EventSeverity eventSeverity;
-        uint64_t eventTimeStamp;
-        type::AssociationDef eventAssociations;
-
-        // Must be ordered based on the serialization to deserialize.
-        archive(eventMsg, eventSeverity, eventTimeStamp, eventAssociations);
-
-        // Skip to send property change signal in the restore path.
-        message(eventMsg, true);
-        severity(eventSeverity, true);
-        timestamp(eventTimeStamp, true);
-        associations(eventAssociations, true);
-    }
+    bool update(const EventSeverity eventSeverity, const EventMsg& eventMsg,
+                const type::AssociationDef& associationDef);
+
+  private:
+    /** @brief Attached bus connection */
+    sdbusplus::bus::bus& _bus;
+
+    /** @brief The id of isolated hardware dbus event */
+    EventId _eventId;
 
 }; // end of Event class
 
@@ -0,0 +1,236 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/write_behind.hpp"
+#include "hw_isolation_event/event.hpp"
+
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace event
+{
+namespace event_store
+{
+
+namespace fs = std::filesystem;
+
+constexpr auto HW_ISOLATION_EVENT_STORE_PERSIST_PATH =
+    "/var/lib/op-hw-isolation/persistdata/event/hw_status.store";
+
+/**
+ * @brief The hardware status event members which are required to restore
+ *        the event.
+ *
+ * @note The event associations are not kept as is since, only the hardware
+ *       inventory path and the bmc error log path are varied.
+ */
+struct PersistedEvent
+{
+    EventSeverity _severity;
+    uint64_t _timestamp;
+    EventMsg _message;
+    std::string _hwInventoryPath;
+    std::string _bmcErrorLogPath;
+};
+
+using PersistedEvents = std::map<EventId, PersistedEvent>;
+
+/**
+ * @class EventStore
+ *
+ * @brief Fixed capacity store to persist all the hardware status events
+ *        in one file.
+ *
+ * @details The event ids are allocated from the persisted counter so,
+ *          the ids are not reused across the restore cycles. The oldest
+ *          event which has the Ok severity is evicted first once the store
+ *          is full, and then the oldest event. The updates are kept
+ *          in memory and written by the write-behind so that, a batch of
+ *          updates is written at once.
+ */
+class EventStore
+{
+  public:
+    EventStore() = delete;
+    EventStore(const EventStore&) = delete;
+    EventStore& operator=(const EventStore&) = delete;
+    EventStore(EventStore&&) = delete;
+    EventStore& operator=(EventStore&&) = delete;
+    ~EventStore() = default;
+
+    /**
+     * @brief Constructor to load the persisted events from the given store
+     *
+     * @param[in] storePath - the store file path
+     * @param[in] legacyDirPath - the directory which contains the events
+     *                            that are persisted in the per event file
+     *                            to import into the store.
+     * @param[in] capacity - the maximum number of events to keep
+     * @param[in] writeBehind - the write-behind to write the updates
+     */
+    EventStore(const fs::path& storePath, const fs::path& legacyDirPath,
+               const size_t capacity, persist::WriteBehind& writeBehind);
+
+    /**
+     * @brief Used to get the persisted events in the creation order
+     *
+     * @return The persisted events
+     */
+    const PersistedEvents& getEvents() const;
+
+    /**
+     * @brief Used to allocate the id for the new event
+     *
+     * @return The allocated event id
+     */
+    EventId allocateEventId();
+
+    /**
+     * @brief Used to add or update the given event
+     *
+     * @param[in] eventId - the event id to add or update
+     * @param[in] event - the event members
+     *
+     * @return The evicted event id if the store was full
+     *         Empty optional if nothing is evicted
+     */
+    std::optional<EventId> put(const EventId eventId,
+                               const PersistedEvent& event);
+
+    /**
+     * @brief Used to remove the given event
+     *
+     * @param[in] eventId - the event id to remove
+     *
+     * @return NULL
+     */
+    void erase(const EventId eventId);
+
+    /**
+     * @brief Used to remove all the events
+     *
+     * @return NULL
+     *
+     * @note The event id counter is not reset.
+     */
+    void clear();
+
+    /**
+     * @brief Used to get the maximum number of events to keep
+     *
+     * @return The store capacity
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief Used to get the number of evicted events since the store
+     *        is loaded.
+     *
+     * @return The number of evicted events
+     */
+    size_t getNumOfEvictedEvents() const;
+
+    /**
+     * @brief Used to get the approximate memory usage of the events
+     *
+     * @return The memory usage in bytes
+     */
+    size_t getMemoryUsage() const;
+
+  private:
+    /**
+     * @brief The store file path
+     */
+    fs::path _storePath;
+
+    /**
+     * @brief The maximum number of events to keep
+     */
+    size_t _capacity;
+
+    /**
+     * @brief The last allocated event id
+     */
+    EventId _lastEventId{0};
+
+    /**
+     * @brief The persisted events
+     */
+    PersistedEvents _events;
+
+    /**
+     * @brief The number of evicted events since the store is loaded
+     */
+    size_t _numOfEvictedEvents{0};
+
+    /**
+     * @brief Indicates whether the events are updated after the last write
+     */
+    bool _dirty{false};
+
+    /**
+     * @brief The write-behind to write the updates
+     */
+    persist::WriteBehind& _writeBehind;
+
+    /**
+     * @brief The writer id in the write-behind
+     */
+    persist::WriterId _writerId;
+
+    /**
+     * @brief Helper API to mark the store is updated
+     *
+     * @return NULL
+     */
+    void markDirty();
+
+    /**
+     * @brief Helper API to write the pending updates into the store file
+     *
+     * @return NULL
+     */
+    void write();
+
+    /**
+     * @brief Helper API to load the store file into memory
+     *
+     * @return NULL
+     *
+     * @note The unreadable store is kept aside to avoid overwriting its
+     *       events, and the event id counter is kept from it if possible.
+     */
+    void load();
+
+    /**
+     * @brief Helper API to import the events which are persisted in the
+     *        per event file.
+     *
+     * @param[in] legacyDirPath - the directory which contains the events
+     *
+     * @return The files which are imported
+     */
+    std::vector<fs::path> importLegacyEvents(const fs::path& legacyDirPath);
+
+    /**
+     * @brief Helper API to evict the oldest events to keep the capacity
+     *
+     * @param[in] keepEventId - the event id to not evict, used to keep
+     *                          the event which is just added
+     *
+     * @return The last evicted event id
+     *         Empty optional if nothing is evicted
+     */
+    std::optional<EventId>
+        evictOldestEvents(std::optional<EventId> keepEventId = std::nullopt);
+};
+
+} // namespace event_store
+} // namespace event
+} // namespace hw_isolation
@@ -2,12 +2,23 @@
 
 #pragma once
 
+#include "common/change_journal.hpp"
+#include "common/debounce_timer.hpp"
 #include "common/isolatable_hardwares.hpp"
+#include "common/restore_status.hpp"
 #include "hw_isolation_event/event.hpp"
+#include "hw_isolation_event/event_store.hpp"
 #include "hw_isolation_record/entry.hpp"
 #include "hw_isolation_record/manager.hpp"
+#include "org/open_power/HardwareIsolation/EventQuery/server.hpp"
+#include "org/open_power/HardwareIsolation/EventStore/server.hpp"
+#include "org/open_power/HardwareIsolation/EventSummary/server.hpp"
 
 #include <sdbusplus/bus.hpp>
+#include <sdeventplus/source/event.hpp>
+
+#include <set>
+#include <unordered_set>
 
 namespace hw_isolation
 {
@@ -18,13 +29,66 @@ namespace hw_status
 
 using HwStatusEvents = std::map<EventId, std::unique_ptr<Event>>;
 
+using EventStoreStatusInterface =
+    sdbusplus::org::open_power::HardwareIsolation::server::EventStore;
+using EventStoreStatus = type::ServerObject<EventStoreStatusInterface>;
+
+using EventSummaryInterface =
+    sdbusplus::org::open_power::HardwareIsolation::server::EventSummary;
+using EventSummary = type::ServerObject<EventSummaryInterface>;
+
+using EventQueryInterface =
+    sdbusplus::org::open_power::HardwareIsolation::server::EventQuery;
+using EventQueryResult =
+    std::tuple<sdbusplus::message::object_path, EventSeverity, uint64_t,
+               EventMsg, sdbusplus::message::object_path,
+               sdbusplus::message::object_path>;
+
+/**
+ * @brief The hardware status event details which are required for
+ *        the hardware as per the latest hardware state.
+ */
+struct DesiredEvent
+{
+    EventSeverity _severity;
+    EventMsg _message;
+    std::string _bmcErrorLogPath;
+};
+
+/**
+ * @brief The required hardware status events by the hardware inventory path
+ */
+using DesiredEvents = std::map<std::string, DesiredEvent>;
+
+/**
+ * @brief Used to hold the hardware status events refresh state across
+ *        the refresh slices.
+ */
+struct RefreshContext
+{
+    bool _osRunning{false};
+    std::vector<std::pair<std::string, struct pdbg_target*>> _targets;
+    size_t _nextTarget{0};
+    DesiredEvents _desiredEvents;
+
+    /**
+     * @brief The events which are updated while refreshing, empty optional
+     *        if the event is removed. Those are applied on top of the
+     *        desired events since, the desired events of the refreshed
+     *        hardware might be stale.
+     */
+    std::map<std::string, std::optional<DesiredEvent>> _updatedEvents;
+};
+
 /**
  *  @class Manager
  *
  *  @brief Hardware status event manager implementation.
  *
+ *  @details Implemetation for below interfaces
+ *           org.open_power.HardwareIsolation.EventQuery
  */
-class Manager
+class Manager : public type::ServerObject<EventQueryInterface>
 {
   public:
     Manager() = delete;
@@ -39,16 +103,50 @@ class Manager
      *  @param[in] bus - Bus to attach to.
      *  @param[in] eventLoop - Attached event loop on bus.
      *  @param[in] hwIsolationRecordMgr - the hardware isolation record manager
+     *  @param[in] writeBehind - the write-behind to persist the events
+     *  @param[in] changeJournal - the journal to add the events changes
      */
     Manager(sdbusplus::bus::bus& bus, const sdeventplus::Event& eventLoop,
-            record::Manager& hwIsolationRecordMgr);
+            record::Manager& hwIsolationRecordMgr,
+            persist::WriteBehind& writeBehind,
+            journal::ChangeJournal& changeJournal);
 
     /**
      * @brief API used to restore the hardware status event.
      *
+     * @param[in] restoreStatus - the restore progress object to update
+     *
      * @return NULL
      */
-    void restore();
+    void restore(restore_status::RestoreStatus& restoreStatus);
+
+    /**
+     * @brief Used to get the current hardware status event of the given
+     *        hardware.
+     *
+     * @param[in] hwInventoryPath - the hardware inventory path
+     *
+     * @return the hardware status event dbus object path if exists
+     *         Empty optional if not exists.
+     */
+    std::optional<sdbusplus::message::object_path>
+        getHwStatusEvent(const std::string& hwInventoryPath) const;
+
+    /**
+     *  @brief Implementation for GetEvents
+     *
+     *  @param[in] severities - The severities to match, empty for any.
+     *  @param[in] inventoryPath - The hardware inventory path to match
+     *                             along with its child hardware, "/" for any.
+     *  @param[in] startTime - The minimum event timestamp, 0 for any.
+     *  @param[in] endTime - The maximum event timestamp, 0 for any.
+     *
+     *  @return The matched events details
+     */
+    std::vector<EventQueryResult>
+        getEvents(std::vector<EventSeverity> severities,
+                  sdbusplus::message::object_path inventoryPath,
+                  uint64_t startTime, uint64_t endTime) override;
 
   private:
     /**
@@ -62,15 +160,53 @@ class Manager
     const sdeventplus::Event& _eventLoop;
 
     /**
-     * @brief Last created event id
+     * @brief The journal to add the hardware status events changes
+     */
+    journal::ChangeJournal& _changeJournal;
+
+    /**
+     * @brief The store to persist the hardware status events
+     */
+    event_store::EventStore _eventStore;
+
+    /**
+     * @brief The event store usage D-Bus object
+     */
+    EventStoreStatus _eventStoreStatus;
+
+    /**
+     * @brief The events summary D-Bus object which is on the hardware
+     *        isolation root object along with the entries summary.
      */
-    EventId _lastEventId;
+    EventSummary _eventSummary;
 
     /**
      * @brief Hardware status event list
      */
     HwStatusEvents _hwStatusEvents;
 
+    /**
+     * @brief The hardware status event id by the hardware inventory path
+     */
+    std::unordered_map<std::string, EventId> _hwStatusEventsByInvPath;
+
+    /**
+     * @brief The severity and the message of the events as those are
+     *        counted in the summary, used to uncount on change.
+     */
+    std::unordered_map<EventId, std::pair<EventSeverity, EventMsg>>
+        _summarizedEvents;
+
+    /**
+     * @brief The number of events by the severity
+     */
+    std::map<EventSeverity, uint32_t> _eventsBySeverity;
+
+    /**
+     * @brief The number of events by the message
+     */
+    std::map<EventMsg, uint32_t> _eventsByMessage;
+
     /**
      * @brief Used to get isolatable hardware details
      */
@@ -97,17 +233,49 @@ class Manager
     /**
      * @brief The list of D-Bus object to watch OperationalStatus
      */
-    std::unordered_map<std::string,
-                       std::unique_ptr<sdbusplus::bus::match::match>>
+    std::unordered_set<std::string> _operationalStatusWatchedObjs;
+
+    /**
+     * @brief The D-Bus match objects to watch OperationalStatus of
+     *        the inventory namespace and, the watched objects addition
+     *        and removal.
+     */
+    std::vector<std::unique_ptr<sdbusplus::bus::match::match>>
         _watcherOnOperationalStatus;
 
     /**
-     * @brief Used to handle the deallocated hardware at the host runtime.
+     * @brief The hardwares which are deallocated at the host runtime and,
+     *        pending to handle.
+     */
+    std::set<std::string> _pendingDeallocatedHws;
+
+    /**
+     * @brief Used to handle the deallocated hardwares at the host runtime
+     *        in a batch per window.
+     */
+    debounce::DebounceTimer _deallocatedHwTimer;
+
+    /**
+     * @brief The in progress hardware status events refresh state
      */
-    std::queue<
-        std::pair<std::string, std::unique_ptr<sdeventplus::utility::Timer<
-                                   sdeventplus::ClockId::Monotonic>>>>
-        _deallocatedHwHandler;
+    std::unique_ptr<RefreshContext> _refreshCtx;
+
+    /**
+     * @brief The event source to run the refresh slices from the event loop
+     */
+    std::unique_ptr<sdeventplus::source::Defer> _refreshSource;
+
+    /**
+     * @brief The isolated hardwares which are changed in the record manager
+     *        and, their events are yet to update.
+     */
+    std::map<std::string, openpower_guard::EntityPath> _changedIsolatedHws;
+
+    /**
+     * @brief The event source to update the events of the changed isolated
+     *        hardwares from the event loop
+     */
+    std::unique_ptr<sdeventplus::source::Defer> _entryChangeSource;
 
     /**
      * @brief Create the hardware status event dbus object
@@ -125,11 +293,68 @@ class Manager
         const std::string& hwInventoryPath, const std::string& bmcErrorLogPath);
 
     /**
-     * @brief Used to clear the old hardwares status event
+     * @brief Used to remove the given hardware status event
+     *
+     * @param[in] eventId - the event id to remove
      *
      * @return NULL
      */
-    void clearHardwaresStatusEvent();
+    void removeEvent(const EventId eventId);
+
+    /**
+     * @brief Used to remove the current hardware status event of the given
+     *        hardware if exists.
+     *
+     * @param[in] hwInventoryPath - the hardware inventory path
+     *
+     * @return NULL
+     */
+    void removeHwStatusEvent(const std::string& hwInventoryPath);
+
+    /**
+     * @brief Used to update the current hardware status event of the given
+     *        hardware as per the given required event.
+     *
+     * @param[in] hwInventoryPath - the hardware inventory path
+     * @param[in] desiredEvent - the required event, empty to remove
+     *                           the current event
+     *
+     * @return NULL
+     */
+    void updateHwStatusEvent(const std::string& hwInventoryPath,
+                             const std::optional<DesiredEvent>& desiredEvent);
+
+    /**
+     * @brief Callback to keep the changed isolated hardware to update
+     *        its event from the event loop.
+     *
+     * @param[in] change - the isolated hardware entry change
+     *
+     * @return NULL
+     */
+    void onEntryChange(const record::EntryChange& change);
+
+    /**
+     * @brief Used to update the events of the changed isolated hardwares
+     *        without processing all the hardware.
+     *
+     * @return NULL
+     */
+    void handleEntryChanges();
+
+    /**
+     * @brief Used to reconcile the existing hardware status events with
+     *        the given required events.
+     *
+     * @param[in] desiredEvents - the required events as per the latest
+     *                            hardware state
+     *
+     * @return NULL
+     *
+     * @note Only the changed events are added, removed or updated in place
+     *       so, the unchanged events keep their id and object.
+     */
+    void reconcileEvents(DesiredEvents desiredEvents);
 
     /**
      * @brief Used to get the isolated hardware record status
@@ -162,37 +387,54 @@ class Manager
     void onBootProgressChange(sdbusplus::message::message& message);
 
     /**
-     * @brief API used to clear the existing events for the given hardware
-     *        inventory path
+     * @brief Used to handle the pending deallocated hardwares at the host
+     *        runtime.
      *
-     * @param[in] hwInventoryPath - The hardware inventory path to clear.
+     * @return NULL
+     *
+     * @note The existing events of all the pending hardwares are removed
+     *       in one pass and then, the new events are created.
+     */
+    void handleDeallocatedHws();
+
+    /**
+     * @brief Used to create event on the object if that object is not
+     *        functional
+     *
+     * @param[in] message - The D-Bus signal message
      *
      * @return NULL
      */
-    void clearHwStatusEventIfexists(const std::string& hwInventoryPath);
+    void onOperationalStatusChange(sdbusplus::message::message& message);
 
     /**
-     * @brief Used to handle the deallocated hardware at the host runtime.
+     * @brief Used to add the object into the OperationalStatus watched
+     *        list if the watched inventory item interface is added.
+     *
+     * @param[in] message - The D-Bus InterfacesAdded signal message
      *
      * @return NULL
      */
-    void handleDeallocatedHw();
+    void onWatchedObjAdded(sdbusplus::message::message& message);
 
     /**
-     * @brief Used to create event on the object if that object is not
-     *        functional
+     * @brief Used to remove the object from the OperationalStatus watched
+     *        list if the watched inventory item interface is removed.
      *
-     * @param[in] message - The D-Bus signal message
+     * @param[in] message - The D-Bus InterfacesRemoved signal message
      *
      * @return NULL
      */
-    void onOperationalStatusChange(sdbusplus::message::message& message);
+    void onWatchedObjRemoved(sdbusplus::message::message& message);
 
     /**
      * @brief Used to create the D-Bus signal watcher on the OperationalStatus
      *        interface for the defined inventory item interface.
      *
      * @return NULL
+     *
+     * @note One match is added for the inventory namespace and, the signals
+     *       are dispatched by the watched objects list.
      */
     void watchOperationalStatusChange();
 
@@ -215,9 +457,50 @@ class Manager
      * @note This function will skip to create
      *       the hardware status event if any failures while
      *       processing all hardware.
+     *       The hardware are processed in slices from the event loop and,
+     *       the existing events are reconciled with the required events
+     *       instead of recreating all once all the hardware are processed.
      */
     void restoreHardwaresStatusEvent(bool osRunning = false);
 
+    /**
+     * @brief Used to process the pending hardware of the in progress refresh
+     *        until the slice time budget is elapsed.
+     *
+     * @return NULL
+     */
+    void refreshHardwaresStatusEvent();
+
+    /**
+     * @brief Used to add the required hardware status event of the given
+     *        hardware into the given events.
+     *
+     * @param[in] pdbgClass - the pdbg class of the given hardware
+     * @param[in] tgt - the hardware pdbg target
+     * @param[in] osRunning - used to decide whether wants to add the cores
+     *                        events if the cores are deallocated at the
+     *                        runtime.
+     * @param[out] desiredEvents - the required events to add
+     *
+     * @return NULL
+     */
+    void addDesiredEvent(const std::string& pdbgClass, struct pdbg_target* tgt,
+                         bool osRunning, DesiredEvents& desiredEvents);
+
+    /**
+     * @brief Used to get the inventory paths which the hardware status
+     *        events of the given hardware are created with.
+     *
+     * @param[in] pdbgClass - the pdbg class of the given hardware
+     * @param[in] tgt - the hardware pdbg target
+     *
+     * @return The inventory paths which are found
+     *
+     * @note The events of the ocmb are created with its dimms inventory path.
+     */
+    std::set<std::string> getEventHwInventoryPaths(const std::string& pdbgClass,
+                                                   struct pdbg_target* tgt);
+
     /**
      * @brief Used to populate the details needed to
      *        create hardware status event for all hardware.
@@ -269,6 +552,31 @@ class Manager
      * @return NULL
      */
     void restorePersistedHwIsolationStatusEvent();
+
+    /**
+     * @brief Helper API to update the event store usage D-Bus object
+     *
+     * @return NULL
+     */
+    void updateEventStoreStatus();
+
+    /**
+     * @brief Helper API to update the events summary counters for the given
+     *        event change.
+     *
+     * @param[in] eventId - the changed event id
+     * @param[in] event - the changed event, nullptr if it is removed
+     *
+     * @return NULL
+     */
+    void summarizeEvent(const EventId eventId, const Event* event);
+
+    /**
+     * @brief Helper API to update the events summary D-Bus object
+     *
+     * @return NULL
+     */
+    void updateEventSummary();
 };
 
 } // namespace hw_status
@@ -6,14 +6,14 @@
 #include "common/phal_devtree_utils.hpp"
 #include "hw_isolation_record/openpower_guard_interface.hpp"
 
-#include <cereal/access.hpp>
-#include <cereal/cereal.hpp>
-#include <cereal/types/vector.hpp>
 #include <xyz/openbmc_project/Association/Definitions/server.hpp>
 #include <xyz/openbmc_project/HardwareIsolation/Entry/server.hpp>
 #include <xyz/openbmc_project/Object/Delete/server.hpp>
 #include <xyz/openbmc_project/Time/EpochTime/server.hpp>
 
+#include <map>
+#include <memory>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -24,9 +24,16 @@ namespace record
 
 class Manager;
 
+/**
+ * @brief The per entry persisted file path which is used before the entries
+ *        were persisted in the log, it is used only to import the entries.
+ */
 constexpr auto HW_ISOLATION_ENTRY_PERSIST_PATH =
     "/var/lib/op-hw-isolation/persistdata/record_entry/{}";
 
+constexpr auto HW_ISOLATION_ENTRY_LOG_PERSIST_PATH =
+    "/var/lib/op-hw-isolation/persistdata/record_entry.log";
+
 namespace entry
 {
 
@@ -45,6 +52,7 @@ using EpochTime = sdbusplus::xyz::openbmc_project::Time::server::EpochTime;
 using DeleteInterface = sdbusplus::xyz::openbmc_project::Object::server::Delete;
 
 using EntryErrLogPath = std::string;
+using EntryErrLogId = uint32_t;
 
 /**
  * @class Entry
@@ -81,6 +89,10 @@ class Entry :
      *  @param[in] associationDef - the association to hold other dbus
      *                              object path along with entry object.
      *  @param[in] entityPath - the entry entity path of hardware
+     *  @param[in] entryErrLogId - the EID (aka PEL ID) which caused the
+     *                             hardware isolation, "0" if none.
+     *  @param[in] deferEmit - used to defer the object added signal so that,
+     *                         the caller can emit it. By default is "false".
      */
     Entry(sdbusplus::bus::bus& bus, const std::string& objPath,
           hw_isolation::record::Manager& hwIsolationRecordMgr,
@@ -88,7 +100,8 @@ class Entry :
           const EntrySeverity isolatedHwSeverity,
           const EntryResolved entryIsResolved,
           const type::AssociationDef& associationDef,
-          const openpower_guard::EntityPath& entityPath);
+          const openpower_guard::EntityPath& entityPath,
+          const EntryErrLogId entryErrLogId, const bool deferEmit = false);
 
     /**
      * @brief Mark this object as resolved
@@ -120,10 +133,61 @@ class Entry :
      */
     EntryRecordId getEntryRecId() const;
 
+    /**
+     * @brief Used get the EID (aka PEL ID) of isolated hardware.
+     */
+    EntryErrLogId getEntryErrLogId() const;
+
+    /**
+     * @brief Used set the EID (aka PEL ID) of isolated hardware.
+     *
+     * @param[in] entryErrLogId - the EID which caused the isolation
+     *
+     * @return NULL
+     */
+    void setEntryErrLogId(const EntryErrLogId entryErrLogId);
+
+    /**
+     * @brief Used to know whether the isolated hardware is ECO core.
+     */
+    bool isEcoCore() const;
+
+    /**
+     * @brief Used set whether the isolated hardware is ECO core.
+     *
+     * @param[in] ecoCore - true if the isolated hardware is ECO core
+     *
+     * @return NULL
+     *
+     * @note The entry will be persisted if the flag is changed.
+     */
+    void setEcoCore(const bool ecoCore);
+
+    /**
+     * @brief Used get the isolated hardware inventory path from
+     *        the entry associations.
+     *
+     * @return The isolated hardware inventory path, empty if not associated
+     */
+    std::string getIsolatedHwInvPath() const;
+
+    /**
+     * @brief Used get the BMC error log path from the entry associations.
+     *
+     * @return The BMC error log path, empty if not associated
+     */
+    EntryErrLogPath getBmcErrorLogPath() const;
+
     /**
      * @brief Serialize and persisted the required members
      *
+     * @details It will only persist the required members that are not
+     *          persisted in the hardware isolation partition file that
+     *          shared between the BMC and Host applications.
+     *
      * @return NULL
+     *
+     * @note Nothing will be written if the members are not changed.
      */
     void serialize();
 
@@ -150,75 +214,29 @@ class Entry :
     /** @brief The entity path of this entry */
     openpower_guard::EntityPath _entityPath;
 
-    /**
-     * @brief Allow cereal class access to allow save and load functions
-     *        to be private
-     */
-    friend class cereal::access;
-
-    /**
-     * @brief Helper template that is required by Cereal to perform
-     *        serialization.
-     *
-     * @details It will only serialize the required members that are not
-     *          persisted in the hardware isolation partition file that
-     *          shared between the BMC and Host applications.
-     *
-     * @tparam Archive    - Cereal archive type (BinaryOutputArchive).
-     * @param[in] archive - Reference to Cereal archive.
-     * @param[in] version - Class version that enables handling
-     *                      a serialized data.
+    /** @brief The EID (aka PEL ID) of this entry as stored in the record
      *
-     * @return NULL
+     *  @note It is not persisted since it is always available in the
+     *        record that is shared between BMC and Host applications.
      */
-    template <class Archive>
-    void save(Archive& archive, const uint32_t /*version*/) const
-    {
-        auto entityPathRawData =
-            hw_isolation::devtree::convertEntityPathIntoRawData(_entityPath);
-
-        archive(entityPathRawData, elapsed());
-    }
+    EntryErrLogId _entryErrLogId;
 
-    /**
-     * @brief Helper template that is required by Cereal to perform
-     *        deserialization.
-     *
-     * @details It will only deserialize the required members that are not
-     *          persisted in the hardware isolation partition file that
-     *          shared between the BMC and Host applications.
-     *
-     * @tparam Archive    - Cereal archive type (BinaryInputArchive).
-     * @param[in] archive - Reference to Cereal archive.
-     * @param[in] version - Class version that enables handling
-     *                      a deserialized data.
+    /** @brief Indicates whether the isolated hardware is ECO core
      *
-     * @return NULL
+     *  @note It is persisted along with the entry since, the ECO core
+     *        inventory path can't be found without it in the restore path.
      */
-    template <class Archive>
-    void load(Archive& archive, const uint32_t /*version*/)
-    {
-        hw_isolation::devtree::DevTreePhysPath persistedEntityPathRawData;
-        uint64_t persistedElapsed;
-
-        // Must be ordered based on the serialization to deserialize.
-        archive(persistedEntityPathRawData, persistedElapsed);
-
-        if (openpower_guard::EntityPath(persistedEntityPathRawData.data(),
-                                        persistedEntityPathRawData.size()) ==
-            _entityPath)
-        {
-            // Skip to send property change signal in the restore path.
-            elapsed(persistedElapsed, true);
-        }
-        else
-        {
-            serialize();
-        }
-    }
+    bool _ecoCore{false};
 
 }; // end of Entry class
 
+} // namespace entry
+
+using IsolatedHardwares =
+    std::map<entry::EntryRecordId, std::unique_ptr<entry::Entry>>;
+
+namespace entry
+{
 namespace utils
 {
 
@@ -0,0 +1,243 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/phal_devtree_utils.hpp"
+#include "common/write_behind.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace hw_isolation
+{
+namespace record
+{
+namespace entry_log
+{
+
+namespace fs = std::filesystem;
+
+using EntryRecordId = uint32_t;
+
+/**
+ * @brief The isolated hardware entry members which are not persisted in
+ *        the hardware isolation partition file that shared between the BMC
+ *        and Host applications.
+ */
+struct PersistedEntry
+{
+    /**
+     * @brief The entity path raw data of the isolated hardware
+     */
+    devtree::DevTreePhysPath _entityPath;
+
+    /**
+     * @brief The isolated hardware entry creation time
+     */
+    uint64_t _elapsed;
+
+    /**
+     * @brief Indicates whether the isolated hardware is ECO core
+     */
+    bool _ecoCore{false};
+
+    /**
+     * @brief The resolved inventory path of the isolated hardware
+     */
+    std::string _inventoryPath;
+
+    /**
+     * @brief The EID (aka PEL ID) and the resolved BMC error log path
+     *        which caused the hardware isolation
+     */
+    uint32_t _errLogId{0};
+    std::string _bmcErrorLogPath;
+
+    /**
+     * @brief The device tree generation which was used to resolve
+     *        the inventory path
+     */
+    uint64_t _generation{0};
+
+    bool operator==(const PersistedEntry&) const = default;
+};
+
+/**
+ * @class EntryLog
+ *
+ * @brief Append only log to persist all the isolated hardware entries in
+ *        one file.
+ *
+ * @details The log starts with a versioned header and, each update is
+ *          appended as one checksummed record. The log is loaded once in
+ *          memory and, it is compacted once the stale records are more than
+ *          the live entries. The updates are appended by the write-behind
+ *          so, the repeated updates of the same entry are coalesced.
+ */
+class EntryLog
+{
+  public:
+    EntryLog() = delete;
+    EntryLog(const EntryLog&) = delete;
+    EntryLog& operator=(const EntryLog&) = delete;
+    EntryLog(EntryLog&&) = delete;
+    EntryLog& operator=(EntryLog&&) = delete;
+    ~EntryLog() = default;
+
+    /**
+     * @brief Constructor to load the persisted entries from the given log
+     *
+     * @param[in] logPath - the log file path
+     * @param[in] legacyDirPath - the directory which contains the entries
+     *                            that are persisted in the per entry file
+     *                            to import into the log.
+     * @param[in] writeBehind - the write-behind to write the updates
+     */
+    EntryLog(const fs::path& logPath, const fs::path& legacyDirPath,
+             persist::WriteBehind& writeBehind);
+
+    /**
+     * @brief Used to get the persisted entry
+     *
+     * @param[in] entryRecordId - the entry record id to get
+     *
+     * @return The persisted entry on success
+     *         Empty optional if not persisted
+     */
+    std::optional<PersistedEntry> get(const EntryRecordId entryRecordId) const;
+
+    /**
+     * @brief Used to get all the persisted entries
+     *
+     * @return The persisted entries
+     */
+    const std::map<EntryRecordId, PersistedEntry>& getEntries() const;
+
+    /**
+     * @brief Used to persist the given entry
+     *
+     * @param[in] entryRecordId - the entry record id to persist
+     * @param[in] entry - the entry members to persist
+     *
+     * @return NULL
+     *
+     * @note Nothing will be appended if the entry is already persisted
+     *       with the same members.
+     */
+    void put(const EntryRecordId entryRecordId, const PersistedEntry& entry);
+
+    /**
+     * @brief Used to remove the given entry from the log
+     *
+     * @param[in] entryRecordId - the entry record id to remove
+     *
+     * @return NULL
+     */
+    void erase(const EntryRecordId entryRecordId);
+
+    /**
+     * @brief Used to remove the entries which are not required to keep
+     *
+     * @param[in] keep - the predicate to decide whether the entry needs
+     *                   to keep or not
+     *
+     * @return NULL
+     */
+    void retain(const std::function<bool(EntryRecordId)>& keep);
+
+  private:
+    /**
+     * @brief The log record operation types
+     */
+    enum class Operation : uint8_t
+    {
+        Put = 1,
+        Erase = 2
+    };
+
+    /**
+     * @brief The log file path
+     */
+    fs::path _logPath;
+
+    /**
+     * @brief The live entries in the log
+     */
+    std::map<EntryRecordId, PersistedEntry> _entries;
+
+    /**
+     * @brief The number of records in the log
+     */
+    size_t _numOfLogRecords{0};
+
+    /**
+     * @brief The log file stream to append the records
+     */
+    std::ofstream _logStream;
+
+    /**
+     * @brief The write-behind to write the updates
+     */
+    persist::WriteBehind& _writeBehind;
+
+    /**
+     * @brief The writer id in the write-behind
+     */
+    persist::WriterId _writerId;
+
+    /**
+     * @brief The entries which are updated after the last write, empty
+     *        optional if the entry is erased.
+     */
+    std::map<EntryRecordId, std::optional<PersistedEntry>> _pendingUpdates;
+
+    /**
+     * @brief Indicates whether the log needs to rewrite in the next write
+     */
+    bool _compactRequired{false};
+
+    /**
+     * @brief Helper API to load the log into memory
+     *
+     * @return true if the log is loaded as is, false if the log needs
+     *         to rewrite due to the corrupted or more stale records.
+     *
+     * @note The log with the unsupported header is kept aside to avoid
+     *       overwriting its entries.
+     */
+    bool load();
+
+    /**
+     * @brief Helper API to import the entries which are persisted in the
+     *        per entry file.
+     *
+     * @param[in] legacyDirPath - the directory which contains the entries
+     *
+     * @return The files which are imported
+     */
+    std::vector<fs::path> importLegacyEntries(const fs::path& legacyDirPath);
+
+    /**
+     * @brief Helper API to write the pending updates into the log
+     *
+     * @return NULL
+     */
+    void write();
+
+    /**
+     * @brief Helper API to rewrite the log with only the live entries
+     *
+     * @return true if the log is rewritten durably else false
+     */
+    bool compact();
+};
+
+} // namespace entry_log
+} // namespace record
+} // namespace hw_isolation
@@ -3,18 +3,29 @@
 #pragma once
 
 #include "common/common_types.hpp"
+#include "common/debounce_timer.hpp"
 #include "common/isolatable_hardwares.hpp"
+#include "common/restore_status.hpp"
 #include "common/watch.hpp"
+#include "common/write_behind.hpp"
 #include "hw_isolation_record/entry.hpp"
+#include "hw_isolation_record/entry_log.hpp"
 #include "hw_isolation_record/openpower_guard_interface.hpp"
+#include "hw_isolation_record/record_diff.hpp"
+#include "org/open_power/HardwareIsolation/Create/server.hpp"
+#include "org/open_power/HardwareIsolation/EntryQuery/server.hpp"
+#include "org/open_power/HardwareIsolation/EntrySummary/server.hpp"
 #include "xyz/openbmc_project/Collection/DeleteAll/server.hpp"
 #include "xyz/openbmc_project/HardwareIsolation/Create/server.hpp"
 
-#include <cereal/types/set.hpp>
+#include <sdbusplus/bus/match.hpp>
 #include <sdeventplus/event.hpp>
-#include <sdeventplus/utility/timer.hpp>
+#include <sdeventplus/source/event.hpp>
 
-#include <queue>
+#include <chrono>
+#include <functional>
+#include <set>
+#include <unordered_map>
 
 namespace hw_isolation
 {
@@ -24,13 +35,125 @@ namespace record
 using CreateInterface =
     sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Create;
 
-using IsolatedHardwares =
-    std::map<entry::EntryRecordId, std::unique_ptr<entry::Entry>>;
-
 using DeleteAllInterface =
     sdbusplus::xyz::openbmc_project::Collection::server::DeleteAll;
 
-using EcoCores = std::set<devtree::DevTreePhysPath>;
+using BulkCreateInterface =
+    sdbusplus::org::open_power::HardwareIsolation::server::Create;
+
+using EntryType =
+    sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type;
+using BulkCreateItem = std::tuple<sdbusplus::message::object_path, EntryType,
+                                  sdbusplus::message::object_path>;
+using BulkCreateResult = std::tuple<sdbusplus::message::object_path,
+                                    std::string>;
+
+using EntryQueryInterface =
+    sdbusplus::org::open_power::HardwareIsolation::server::EntryQuery;
+using EntrySummaryInterface =
+    sdbusplus::org::open_power::HardwareIsolation::server::EntrySummary;
+using EntryQueryResult =
+    std::tuple<sdbusplus::message::object_path, EntryType, bool, uint64_t,
+               sdbusplus::message::object_path,
+               sdbusplus::message::object_path>;
+
+using RestoredCallback = std::function<void(void)>;
+
+/**
+ * @brief The mode to run the restore steps
+ */
+enum class RestoreMode
+{
+    /**
+     * Run all the steps before claiming the bus name.
+     */
+    Blocking,
+
+    /**
+     * Run the steps in slices from the event loop while serving requests.
+     */
+    Incremental,
+
+    /**
+     * Run the remaining steps to serve the conflicting request without
+     * waiting for the BMC error log paths.
+     */
+    Drain
+};
+
+/**
+ * @brief The type of change on the isolated hardware entries to notify
+ *        the subscribers.
+ */
+enum class EntryChangeType
+{
+    Added,
+    Resolved,
+    SeverityChanged,
+    ErrorLogChanged
+};
+
+/**
+ * @brief Used to hold a single change on the isolated hardware entries
+ *
+ * @note The subscribers can get the latest entry details by using
+ *       the isolated hardware inventory path.
+ */
+struct EntryChange
+{
+    EntryChangeType _type;
+    entry::EntryRecordId _entryRecordId;
+    std::string _isolatedHwInvPath;
+    openpower_guard::EntityPath _entityPath;
+};
+
+using EntryChangeSubscriber = std::function<void(const EntryChange&)>;
+
+/**
+ * @brief Used to hold the restore state across the restore steps
+ */
+struct RestoreContext
+{
+    /**
+     * @brief The restore stages
+     */
+    enum class Stage
+    {
+        Inventory,
+        ErrorLog,
+        Entry,
+        Completed
+    };
+
+    /**
+     * @brief The record details which are resolved to restore
+     */
+    struct RecordToRestore
+    {
+        const openpower_guard::GuardRecord* _record;
+        devtree::DevTreePhysPath _physPath;
+        std::string _physPathStr;
+        entry::EntrySeverity _severity;
+        bool _ecoCore;
+        sdbusplus::message::object_path _inventoryPath;
+        bool _persistedPaths{false};
+        std::string _bmcErrorLogPath;
+    };
+
+    Stage _stage{Stage::Inventory};
+    RestoreMode _mode{RestoreMode::Blocking};
+    openpower_guard::GuardRecords _records;
+    std::vector<RecordToRestore> _recordsToRestore;
+    size_t _nextRecord{0};
+    size_t _numOfFRULookups{0};
+    std::set<uint32_t> _pendingEids;
+    std::map<uint32_t, sdbusplus::message::object_path> _bmcErrorLogPaths;
+    std::vector<sdbusplus::slot_t> _pendingErrorLogCalls;
+    size_t _numOfRestoredEntries{0};
+    std::chrono::steady_clock::time_point _startTime;
+    std::chrono::steady_clock::time_point _stageStartTime;
+    RestoredCallback _restoredCallback;
+};
 
 /**
  *  @class Manager
@@ -41,8 +164,13 @@ using EcoCores = std::set<devtree::DevTreePhysPath>;
  *           xyz.openbmc_project.HardwareIsolation.Create
  *           xyz.openbmc_project.Collection.DeleteAll
  *           org.open_power.HardwareIsolation.Create
+ *           org.open_power.HardwareIsolation.EntryQuery
+ *           org.open_power.HardwareIsolation.EntrySummary
  */
-class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
+class Manager :
+    public type::ServerObject<CreateInterface, DeleteAllInterface,
+                              BulkCreateInterface, EntryQueryInterface,
+                              EntrySummaryInterface>
 {
   public:
     Manager() = delete;
@@ -57,9 +185,11 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
      *  @param[in] bus - Bus to attach to.
      *  @param[in] path - Path to attach at.
      *  @param[in] eventLoop - Attached event loop on bus.
+     *  @param[in] writeBehind - The write-behind to persist the entries.
      */
     Manager(sdbusplus::bus::bus& bus, const std::string& objPath,
-            const sdeventplus::Event& eventLoop);
+            const sdeventplus::Event& eventLoop,
+            persist::WriteBehind& writeBehind);
 
     /**
      *  @brief Implementation for Create
@@ -94,6 +224,53 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
             severity,
         sdbusplus::message::object_path bmcErrorLog) override;
 
+    /**
+     *  @brief Implementation for CreateBulk
+     *
+     *  @param[in] hardwares - The list of hardware inventory path, severity
+     *                         and BMC error log ("/" if none) to isolate.
+     *
+     *  @return The created or updated
+     *          xyz.openbmc_project.HardwareIsolation.Entry object path and
+     *          the D-Bus error name on failure for each given hardware.
+     */
+    std::vector<BulkCreateResult>
+        createBulk(std::vector<BulkCreateItem> hardwares) override;
+
+    /**
+     *  @brief Implementation for GetEntries
+     *
+     *  @param[in] severities - The severities to match, empty for any.
+     *  @param[in] resolved - The resolved status to match.
+     *  @param[in] inventoryPath - The isolated hardware inventory path to
+     *                             match along with its child hardware,
+     *                             "/" for any.
+     *  @param[in] locationCode - The FRU location code to match, empty for
+     *                            any.
+     *  @param[in] errorLog - The BMC error log presence to match.
+     *  @param[in] startTime - The minimum creation time, 0 for any.
+     *  @param[in] endTime - The maximum creation time, 0 for any.
+     *
+     *  @return The matched entries details
+     */
+    std::vector<EntryQueryResult>
+        getEntries(std::vector<entry::EntrySeverity> severities,
+                   EntryQueryInterface::ResolvedFilter resolved,
+                   sdbusplus::message::object_path inventoryPath,
+                   std::string locationCode,
+                   EntryQueryInterface::ErrorLogFilter errorLog,
+                   uint64_t startTime, uint64_t endTime) override;
+
+    /**
+     *  @brief Implementation for GetHardwareEntries
+     *
+     *  @param[in] hardware - The hardware inventory path to get the entries
+     *
+     *  @return The given hardware entries details, empty if not isolated
+     */
+    std::vector<EntryQueryResult>
+        getHardwareEntries(sdbusplus::message::object_path hardware) override;
+
     /**
      * @brief Erase the entry from the manager
      *
@@ -114,10 +291,28 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
      * @brief Create dbus objects for isolated hardwares
      *        from their persisted location.
      *
+     * @param[in] restoreStatus - the restore progress object to update
+     *
      * return NULL on success.
      *        Throw exception on failure.
      */
-    void restore();
+    void restore(restore_status::RestoreStatus& restoreStatus);
+
+    /**
+     * @brief Create dbus objects for isolated hardwares from their persisted
+     *        location in slices from the event loop so that, the requests
+     *        can be served while restoring.
+     *
+     * @param[in] restoreStatus - the restore progress object to update
+     * @param[in] restoredCallback - the callback to call once restored
+     *
+     * @return NULL
+     *
+     * @note The requests which are conflicting with the restore will
+     *       complete the restore before serving.
+     */
+    void restoreIncrementally(restore_status::RestoreStatus& restoreStatus,
+                              RestoredCallback restoredCallback);
 
     /**
      * @brief Callback to process hardware isolation record file
@@ -145,6 +340,44 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
     int getHigherPrecendenceEntry(
         std::vector<entry::EntrySeverity>& eventSeverityList);
 
+    /**
+     * @brief Used to get the log which persists the isolated hardware entries
+     *
+     * @return The isolated hardware entries log
+     */
+    entry_log::EntryLog& getEntryLog();
+
+    /**
+     * @brief Used to get the device tree generation to persist along with
+     *        the resolved paths of the entries
+     *
+     * @return The device tree generation
+     */
+    uint64_t getDevTreeGeneration() const;
+
+    /**
+     * @brief Used to subscribe the isolated hardware entries changes
+     *
+     * @param[in] subscriber - the subscriber to call for each change
+     *
+     * @return NULL
+     *
+     * @note The entries which are restored from the persisted location are
+     *       not notified, and the subscriber should not add or remove
+     *       the entries while notifying.
+     */
+    void subscribe(EntryChangeSubscriber subscriber);
+
+    /**
+     * @brief Helper API to check whether hardware isolation record
+     *        is valid or not.
+     *
+     * @param[in] recordId - The record id to check
+     *
+     * @return true if the given record id is valid else false
+     */
+    static bool isValidRecord(const entry::EntryRecordId recordId);
+
   private:
     /**
      *  * @brief Attached bus connection
@@ -156,11 +389,68 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
      */
     const sdeventplus::Event& _eventLoop;
 
+    /**
+     * @brief The write-behind to persist the entries
+     */
+    persist::WriteBehind& _writeBehind;
+
+    /**
+     * @brief The log to persist the isolated hardware entries
+     *
+     * @note It must be declared before the entries to destroy after them.
+     */
+    entry_log::EntryLog _entryLog;
+
+    /**
+     * @brief The device tree generation which is used to decide whether
+     *        the persisted paths of the entries can be reused
+     */
+    uint64_t _devTreeGeneration;
+
     /**
      * @brief Isolated hardwares list
      */
     IsolatedHardwares _isolatedHardwares;
 
+    /**
+     * @brief The isolated hardware entries by the isolated hardware
+     *        inventory path to look up the entries without walking all.
+     */
+    std::unordered_map<std::string, std::set<entry::EntryRecordId>>
+        _entriesByInvPath;
+
+    /**
+     * @brief The FRU location code (unexpanded) of the isolated hardware
+     *        entries, it is filled on demand by the queries since, getting
+     *        the location code requires the device tree lookup.
+     */
+    std::unordered_map<entry::EntryRecordId, type::LocationCode>
+        _entriesFRULocCode;
+
+    /**
+     * @brief The severity and the resolved status of the entries as those
+     *        are counted in the summary, used to uncount on change.
+     */
+    std::unordered_map<entry::EntryRecordId,
+                       std::pair<entry::EntrySeverity, entry::EntryResolved>>
+        _summarizedEntries;
+
+    /**
+     * @brief The number of unresolved entries by the severity
+     */
+    std::map<entry::EntrySeverity, uint32_t> _unresolvedEntriesBySeverity;
+
+    /**
+     * @brief The number of resolved entries
+     */
+    uint32_t _numOfResolvedEntries{0};
+
+    /**
+     * @brief The event source to publish the entries summary once for
+     *        a batch of changes from the event loop
+     */
+    std::unique_ptr<sdeventplus::source::Defer> _summarySource;
+
     /**
      * @brief Used to get isolatable hardware details
      */
@@ -172,64 +462,145 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
     watch::inotify::Watch _guardFileWatch;
 
     /**
-     * @brief Timer to wake and process hardware isolation record file
+     * @brief Debounce timer to process the hardware isolation record file
+     *        once the host is done with its updates on the file
      */
-    std::queue<std::unique_ptr<
-        sdeventplus::utility::Timer<sdeventplus::ClockId::Monotonic>>>
-        _timerObjs;
+    debounce::DebounceTimer _guardFileDebounce;
 
     /**
-     * @brief Used to maintain isolated eco core records.
-     *
-     * @details * TODO: It is a workaround until fix the following issue
-     *            ibm-openbmc/dev/issues/3573.
-     *          * It will only persisted to use in the disruptive code update
-     *            restore path.
+     * @brief The restore progress object to update while restoring
+     */
+    restore_status::RestoreStatus* _restoreStatus{nullptr};
+
+    /**
+     * @brief The in progress restore state
+     */
+    std::unique_ptr<RestoreContext> _restoreCtx;
+
+    /**
+     * @brief The event source to run the restore slices from the event loop
+     */
+    std::unique_ptr<sdeventplus::source::Defer> _restoreSource;
+
+    /**
+     * @brief Whether the restore steps are in progress in the call stack
      */
-    EcoCores _persistedEcoCores;
+    bool _runningRestoreSteps{false};
 
     /**
-     * @brief Allow cereal class access to allow save and load functions
-     *        to be private
+     * @brief The event source to call the restored callback from the event
+     *        loop once the restore is completed
      */
-    friend class cereal::access;
+    std::unique_ptr<sdeventplus::source::Defer> _restoredSource;
 
     /**
-     * @brief Helper template that is required by Cereal to perform
-     *        serialization and deserialization.
+     * @brief The pending calls to get the BMC error log paths of the entries
+     *        which are restored to serve the conflicting request
+     */
+    std::vector<sdbusplus::slot_t> _drainedErrorLogCalls;
+
+    /**
+     * @brief The entries which are restored by using the persisted paths
+     *        and, yet to validate the paths
+     */
+    std::vector<entry::EntryRecordId> _entriesToValidate;
+
+    /**
+     * @brief The event source to validate the persisted paths of the entries
+     *        from the event loop
+     */
+    std::unique_ptr<sdeventplus::source::Defer> _validateSource;
+
+    /**
+     * @brief The host changes which are yet to apply on the entries
+     */
+    diff::ChangeSet _changesToApply;
+
+    /**
+     * @brief The next change to apply from the pending host changes
+     */
+    size_t _nextChange{0};
+
+    /**
+     * @brief The event source to apply the pending host changes in slices
+     *        from the event loop
+     */
+    std::unique_ptr<sdeventplus::source::Defer> _reconcileSource;
+
+    /**
+     * @brief The records which are waiting for their inventory to create
+     *        the entries along with their FRU location code, empty if
+     *        failed to get.
+     */
+    std::map<entry::EntryRecordId, type::LocationCode> _pendingRecords;
+
+    /**
+     * @brief The D-Bus match object to retry the pending records when
+     *        the inventory is added.
+     */
+    std::unique_ptr<sdbusplus::bus::match::match> _inventoryAddedWatcher;
+
+    /**
+     * @brief The subscribers of the isolated hardware entries changes
+     */
+    std::vector<EntryChangeSubscriber> _entryChangeSubscribers;
+
+    /**
+     * @brief Used to notify the given entry change to the subscribers
      *
-     * @details * TODO: It is a workaround until fix the following issue
-     *            ibm-openbmc/dev/issues/3573.
-     *          * It will only serialize and deserialize
-     *            the "_persistedEcoCores" member that is not persisted
-     *            in the disruptive code update.
+     * @param[in] type - the change type
+     * @param[in] entryRecordId - the changed entry record id
+     * @param[in] entry - the changed entry
+     *
+     * @return NULL
+     */
+    void publishEntryChange(const EntryChangeType type,
+                            const entry::EntryRecordId entryRecordId,
+                            const entry::Entry& entry);
+
+    /**
+     * @brief Used to update the entries summary counters for the given entry
+     *        change and, schedule to publish the summary.
      *
-     * @tparam Archive    - Cereal archive type.
-     * @param[in] archive - Reference to Cereal archive.
-     * @param[in] version - Class version that enables handling
-     *                      a serialized data.
+     * @param[in] entryRecordId - the changed entry record id
+     * @param[in] entry - the changed entry, nullptr if it is removed
      *
      * @return NULL
      */
-    template <class Archive>
-    void serialize(Archive& archive, const uint32_t /*version*/)
-    {
-        archive(_persistedEcoCores);
-    }
+    void summarizeEntry(const entry::EntryRecordId entryRecordId,
+                        const entry::Entry* entry);
+
+    /**
+     * @brief Used to publish the entries summary counters on D-Bus
+     *
+     * @return NULL
+     */
+    void publishEntrySummary();
 
     /**
-     * @brief Used to serialize ECO core records.
+     * @brief Used to import the isolated ECO core records which were
+     *        persisted separately into the respective entries.
      *
      * @return NULL
+     *
+     * @note The ECO core flag is persisted along with the entry.
      */
-    void serialize();
+    void importPersistedEcoCores();
 
     /**
-     * @brief Used to Deserialize ECO core records.
+     * @brief Used to know whether the given record was persisted as
+     *        ECO core.
+     *
+     * @param[in] recordId - the record id to check
+     * @param[in] entityPathRawData - the record entity path raw data
      *
-     * @return true if deserialized false otherwise.
+     * @return true if persisted as ECO core false otherwise.
+     *
+     * @note The persisted entry of the given record is used if exists
+     *       else, any persisted ECO core entry of the same physical path.
      */
-    bool deserialize();
+    bool isPersistedEcoCore(const entry::EntryRecordId recordId,
+                            const devtree::DevTreePhysPath& entityPathRawData);
 
     /**
      * @brief Used to get EID (aka PEL ID) by using BMC log
@@ -255,6 +626,13 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
      *                          isolation
      * @param[in] deleteRecord - delete record if failed to create entry
      * @param[in] entityPath - the isolated hardware entity path
+     * @param[in] errLogId - the EID (aka PEL ID) which caused the hardware
+     *                       isolation
+     * @param[in] deferred - used to defer the entry object added signal
+     *                       and the isolated hardware enabled property
+     *                       update so that, the caller can do them for many
+     *                       entries together by using completeDeferredEntries.
+     *                       By default is "false".
      *
      * @return entry object path on success
      *         Empty optional on failure
@@ -265,7 +643,22 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
                     const entry::EntrySeverity& severity,
                     const std::string& isolatedHardware,
                     const std::string& bmcErrorLog, const bool deleteRecord,
-                    const openpower_guard::EntityPath& entityPath);
+                    const openpower_guard::EntityPath& entityPath,
+                    const entry::EntryErrLogId errLogId,
+                    const bool deferred = false);
+
+    /**
+     * @brief Used to complete the deferred entries creation i.e. update
+     *        the isolated hardware enabled property and emit the entry
+     *        object added signal for all the given entries together.
+     *
+     * @param[in] entryRecordIds - The entries record id which are created
+     *                             with deferred
+     *
+     * @return NULL
+     */
+    void completeDeferredEntries(
+        const std::vector<entry::EntryRecordId>& entryRecordIds);
 
     /**
      * @brief Update a entry dbus object for isolated hardware if exists
@@ -277,6 +670,8 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
      * @param[in] bmcErrorLog - The error log which caused the hardware
      *                          isolation
      * @param[in] entityPath - the isolated hardware entity path
+     * @param[in] errLogId - the EID (aka PEL ID) which caused the hardware
+     *                       isolation
      *
      * @return pair<true, object_path> on success
      *         pair<false, ""> on failure
@@ -286,7 +681,8 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
                     const entry::EntrySeverity& severity,
                     const std::string& isolatedHwDbusObjPath,
                     const std::string& bmcErrorLog,
-                    const openpower_guard::EntityPath& entityPath);
+                    const openpower_guard::EntityPath& entityPath,
+                    const entry::EntryErrLogId errLogId);
 
     /**
      * @brief Used to get to know whether hardware isolation is allowed
@@ -317,74 +713,332 @@ class Manager : public type::ServerObject<CreateInterface, DeleteAllInterface>
                               const bool isRestorePath = false);
 
     /**
-     * @brief Update the given dbus entry object for isolated hardware record
+     * @brief Used to prepare the restore i.e. get the records and resolve
+     *        the device tree details to restore.
      *
-     * @param[in] record - The isolated hardware record
-     * @param[out] entryIt - The dbus entry object to update
+     * @param[in] restoreStatus - the restore progress object to update
+     * @param[in] mode - the restore mode
      *
-     * @return NULL on success
+     * @return NULL
+     */
+    void beginRestore(restore_status::RestoreStatus& restoreStatus,
+                      RestoreMode mode);
+
+    /**
+     * @brief Used to run the restore steps as per the restore mode
      *
-     * @note The function will skip given isolated hardware to update
-     *       dbus entry if any failure since this is restoring mechanism
-     *       so the hardware isolation application need to update dbus entries
-     *       for all isolated hardware that is stored in the preserved location.
+     * @return NULL
+     *
+     * @note The incremental mode runs only one slice of the current stage.
+     *       The steps are not started over if those are already in progress
+     *       in the call stack.
      */
-    void updateEntryForRecord(const openpower_guard::GuardRecord& record,
-                              IsolatedHardwares::iterator& entryIt);
+    void runRestoreSteps();
 
     /**
-     * @brief Callback to add the dbus entry for host isolated hardwares.
+     * @brief Helper API to run the restore steps
      *
      * @return NULL
      */
-    void handleHostIsolatedHardwares();
+    void runRestoreSlice();
 
     /**
-     * @brief clear all dbus entries.
+     * @brief Helper API to get the inventory path of the records to restore
+     *
+     * @param[in] maxRecords - the maximum number of records to process
      *
      * @return NULL
+     */
+    void restoreInventoryPaths(size_t maxRecords);
+
+    /**
+     * @brief Helper API to get the BMC error log paths of the records to
+     *        restore
      *
-     * @note This function just removes the dbus entries, Use deleteAll() to
-     * resolve guard records.
+     * @return NULL
+     *
+     * @note The incremental mode requests all the paths and, the next stage
+     *       is started once all the replies are received.
      */
-    void clearDbusEntries();
+    void restoreErrorLogPaths();
 
     /**
-     * @brief Helper API to check whether hardware isolation record
-     *        is valid or not.
+     * @brief Helper API to create the entries of the records to restore
      *
-     * @param[in] recordId - The record id to check
+     * @param[in] maxRecords - the maximum number of records to process
      *
-     * @return true if the given record id is valid else false
+     * @return NULL
      */
-    bool isValidRecord(const entry::EntryRecordId recordId);
+    void restoreEntries(size_t maxRecords);
 
     /**
-     * @brief Helper API to cleanup persisted files
+     * @brief Helper API to move the restore into the given stage
+     *
+     * @param[in] stage - the next restore stage
      *
      * @return NULL
      */
-    void cleanupPersistedFiles();
+    void setRestoreStage(RestoreContext::Stage stage);
 
     /**
-     * @brief Helper API to update ECO cores list based on the given
-     *        "ecoCore" flag.
+     * @brief Helper API to complete the restore
      *
-     * @param[in] ecoCore - Indicate whether the Core is eco core or not.
-     * @param[in] coreDevTreePhysPath - The core device tree physical path.
+     * @return NULL
+     */
+    void completeRestore();
+
+    /**
+     * @brief Used to complete the in progress restore (if any) before serving
+     *        the request which is conflicting with the restore.
+     *
+     * @return NULL
+     */
+    void drainRestore();
+
+    /**
+     * @brief Used to add the BMC error log association to the restored
+     *        entries of the given EID once the log path is received
+     *
+     * @param[in] eid - The EID (aka PEL ID) of the BMC error log
+     * @param[in] bmcLogPath - The BMC error log object path
      *
      * @return NULL
      */
-    void
-        updateEcoCoresList(const bool ecoCore,
-                           const devtree::DevTreePhysPath& coreDevTreePhysPath);
+    void restoreEntriesErrorLogPath(
+        uint32_t eid, const sdbusplus::message::object_path& bmcLogPath);
 
     /**
-     * @brief Helper API to cleanup persisted eco cores
+     * @brief Used to validate the paths of the entries which are restored
+     *        by using the persisted paths in the background
      *
      * @return NULL
      */
-    void cleanupPersistedEcoCores();
+    void validatePersistedPaths();
+
+    /**
+     * @brief Helper API to validate the paths of the given entry and,
+     *        update the entry if the paths are changed
+     *
+     * @param[in] entryRecordId - The entry record id to validate
+     *
+     * @return NULL
+     */
+    void validateEntryPaths(const entry::EntryRecordId entryRecordId);
+
+    /**
+     * @brief Used to keep the given record as pending to create its entry
+     *        once the inventory is added.
+     *
+     * @param[in] recordId - The record id which is failed to get inventory
+     * @param[in] entityPathRawData - The record entity path raw data
+     *
+     * @return NULL
+     */
+    void addPendingRecord(const entry::EntryRecordId recordId,
+                          const devtree::DevTreePhysPath& entityPathRawData);
+
+    /**
+     * @brief Used to remove the given record from the pending records
+     *
+     * @param[in] recordId - The record id to remove
+     *
+     * @return NULL
+     */
+    void removePendingRecord(const entry::EntryRecordId recordId);
+
+    /**
+     * @brief Used to remove the pending records which are not exist in
+     *        the given records.
+     *
+     * @param[in] records - The latest isolated hardware records
+     *
+     * @return NULL
+     */
+    void prunePendingRecords(const openpower_guard::GuardRecords& records);
+
+    /**
+     * @brief Callback to retry the pending records which are matching with
+     *        the added inventory location code.
+     *
+     * @param[in] message - The InterfacesAdded D-Bus signal message
+     *
+     * @return NULL
+     */
+    void onInventoryAdded(sdbusplus::message::message& message);
+
+    /**
+     * @brief Used to add the given entry into the inventory path index
+     *
+     * @param[in] entryRecordId - The entry record id to add
+     * @param[in] isolatedHardware - The isolated hardware inventory path
+     *
+     * @return NULL
+     */
+    void indexEntry(const entry::EntryRecordId entryRecordId,
+                    const std::string& isolatedHardware);
+
+    /**
+     * @brief Used to remove the given entry from the inventory path index
+     *
+     * @param[in] entryRecordId - The entry record id to remove
+     * @param[in] isolatedHardware - The isolated hardware inventory path
+     *
+     * @return NULL
+     */
+    void unindexEntry(const entry::EntryRecordId entryRecordId,
+                      const std::string& isolatedHardware);
+
+    /**
+     * @brief Used to get the FRU location code of the given entry
+     *
+     * @param[in] entryRecordId - The entry record id
+     * @param[in] entry - The entry to get the location code
+     *
+     * @return The unexpanded FRU location code, empty if failed to get
+     */
+    const type::LocationCode&
+        getEntryFRULocCode(const entry::EntryRecordId entryRecordId,
+                           const entry::Entry& entry);
+
+    /**
+     * @brief Used to get the given entry details to return in the queries
+     *
+     * @param[in] entryRecordId - The entry record id
+     * @param[in] entry - The entry to get the details
+     *
+     * @return The entry details
+     */
+    EntryQueryResult
+        getEntryQueryResult(const entry::EntryRecordId entryRecordId,
+                            const entry::Entry& entry) const;
+
+    /**
+     * @brief Used to get the existing entry which already isolates the given
+     *        hardware as requested so that, the request can be served
+     *        without writing the guard record.
+     *
+     * @param[in] isolatedHardware - The hardware inventory path to isolate
+     * @param[in] severity - The requested severity
+     * @param[in] bmcErrorLog - The requested error log path, empty if none
+     *
+     * @return The existing entry object path if the hardware is isolated
+     *         with the same or higher precedence severity and the same
+     *         error log
+     *         Empty optional otherwise
+     */
+    std::optional<sdbusplus::message::object_path>
+        getIsolatedEntry(const std::string& isolatedHardware,
+                         const entry::EntrySeverity& severity,
+                         const std::string& bmcErrorLog);
+
+    /**
+     * @brief Resolve the given entries in a batch
+     *
+     * @param[in] entryRecordIds - The entries record id to resolve
+     *
+     * @return NULL
+     *
+     * @note The guard records won't be cleared and, the enabled property
+     *       of the isolated hardware and, the entry object removed
+     *       signals are updated together for all the given entries.
+     */
+    void resolveEntries(
+        const std::vector<entry::EntryRecordId>& entryRecordIds);
+
+    /**
+     * @brief Apply the given change set on the isolated hardware entries
+     *
+     * @param[in] changeSet - The changes to apply
+     *
+     * @return NULL
+     *
+     * @note The removed entries are resolved immediately and, the remaining
+     *       changes are applied in slices from the event loop so that,
+     *       the requests can be served in between. The pending changes
+     *       from the previous change set (if any) are dropped since,
+     *       the given change set is computed from the latest records.
+     */
+    void applyChangeSet(diff::ChangeSet changeSet);
+
+    /**
+     * @brief Apply the given change on the isolated hardware entries
+     *
+     * @param[in] change - The change to apply
+     *
+     * @return NULL
+     *
+     * @note The function will skip the change if any failure while applying
+     *       so that, other changes can be applied.
+     */
+    void applyChange(const diff::Change& change);
+
+    /**
+     * @brief Apply the pending host changes until the slice time budget
+     *        is elapsed.
+     *
+     * @return NULL
+     */
+    void applyPendingChanges();
+
+    /**
+     * @brief Used to drop the pending host changes of the given entry
+     *
+     * @param[in] entryRecordId - The entry record id which is updated or
+     *                            erased by the request
+     *
+     * @return NULL
+     *
+     * @note The pending changes are computed from the records before
+     *       the request so, those can't be applied after the request.
+     */
+    void dropPendingChanges(const entry::EntryRecordId entryRecordId);
+
+    /**
+     * @brief Update the severity of the given entry by using the record
+     *
+     * @param[in] record - The isolated hardware record
+     * @param[out] entryIt - The dbus entry object to update
+     *
+     * @return NULL
+     */
+    void updateEntrySeverity(const openpower_guard::GuardRecord& record,
+                             IsolatedHardwares::iterator& entryIt);
+
+    /**
+     * @brief Update the error log association of the given entry by using
+     *        the record
+     *
+     * @param[in] record - The isolated hardware record
+     * @param[out] entryIt - The dbus entry object to update
+     *
+     * @return NULL
+     */
+    void updateEntryErrorLog(const openpower_guard::GuardRecord& record,
+                             IsolatedHardwares::iterator& entryIt);
+
+    /**
+     * @brief Callback for the debounced guard file updates
+     *
+     * @return NULL
+     *
+     * @note The refresh is skipped if the guard file is updated only by
+     *       this daemon since the last reconciliation.
+     */
+    void handleGuardFileUpdates();
+
+    /**
+     * @brief Callback to add the dbus entry for host isolated hardwares.
+     *
+     * @return NULL
+     */
+    void handleHostIsolatedHardwares();
+
+    /**
+     * @brief Helper API to cleanup persisted files
+     *
+     * @return NULL
+     */
+    void cleanupPersistedFiles();
 };
 
 } // namespace record
@@ -4,7 +4,13 @@
 
 #include <libguard/guard_interface.hpp>
 
+#include <cstdint>
 #include <filesystem>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
 
 namespace hw_isolation
 {
@@ -18,6 +24,37 @@ using GuardRecord = libguard::GuardRecord;
 using EntityPath = libguard::EntityPath;
 using GuardRecords = libguard::GuardRecords;
 
+/**
+ * @brief The guard record details to create i.e. the hardware path,
+ *        the error log id (aka EID) and the guard type.
+ */
+using GuardRecordToCreate = std::tuple<EntityPath, uint32_t, GardType>;
+
+/**
+ * @brief The created guard record on success or
+ *        the D-Bus error name on failure.
+ */
+using CreatedGuardRecord = std::variant<GuardRecord, std::string>;
+
+/**
+ * @brief Used to identify the content of the guard file to avoid
+ *        reparsing the unchanged guard records.
+ */
+struct GuardFileFingerprint
+{
+    /**
+     * @brief The guard file size in bytes
+     */
+    uintmax_t _size;
+
+    /**
+     * @brief The FNV-1a hash of the guard file content
+     */
+    uint64_t _hash;
+
+    bool operator==(const GuardFileFingerprint&) const = default;
+};
+
 /**
  * @brief Wrapper function for libguard::create to create guard record
  *        into partition
@@ -34,6 +71,21 @@ std::optional<GuardRecord> create(const EntityPath& entityPath,
                                   const uint32_t errorLogId,
                                   const GardType guardType);
 
+/**
+ * @brief Used to create the given guard records into partition together
+ *
+ * @param[in] recordsToCreate - the guard records details to create
+ *
+ * @return The created guard record or the D-Bus error name for each given
+ *         guard record details in the same order.
+ *
+ * @note The failure to create one guard record won't stop creating
+ *       the remaining guard records. The guard records are still written
+ *       one by one since, libguard doesn't provide the batch write.
+ */
+std::vector<CreatedGuardRecord>
+    createBatch(const std::vector<GuardRecordToCreate>& recordsToCreate);
+
 /**
  * @brief Wrapper function for libguard::clear to delete guard record
  *        by using record id
@@ -63,9 +115,64 @@ void clearAll();
  *
  * @return The all guard records on success
  *         Throw exception on failure
+ *
+ * @note The parsed records are cached along with the guard file fingerprint
+ *       and, the cached records are returned without reparsing the guard
+ *       file if its fingerprint is not changed since the last parse.
+ *       The records are not cached if the guard file is updated while
+ *       parsing.
  */
 GuardRecords getAll(bool persistentTypeOnly = false);
 
+/**
+ * @brief Used to get the fingerprint of the current guard file content
+ *
+ * @return The guard file fingerprint on success
+ *         Empty optional if the guard file is not readable
+ */
+std::optional<GuardFileFingerprint> getGuardFileFingerprint();
+
+/**
+ * @brief Used to mark the last read guard records as reconciled
+ *        i.e. the isolated hardware entries are reflecting them.
+ *
+ * @return NULL
+ *
+ * @note The guard records writes which are done through this wrapper are
+ *       applied on top of the reconciled records so that, the guard file
+ *       update notification for those writes can be ignored.
+ */
+void markRecordsReconciled();
+
+/**
+ * @brief Used to drop the reconciled guard records i.e. the isolated
+ *        hardware entries might not be reflecting them.
+ *
+ * @return NULL
+ *
+ * @note The next guard file update notification will be reconciled again.
+ */
+void resetReconciledRecords();
+
+/**
+ * @brief Used to know whether the current guard records are already
+ *        reconciled i.e. those are not changed by anyone other than this
+ *        wrapper since the last reconciliation.
+ *
+ * @return true if reconciled else false (including the failure to read)
+ */
+bool isReconciled();
+
+/**
+ * @brief Used to check whether the given guard record id is valid i.e.
+ *        the record is not resolved.
+ *
+ * @param[in] recordId - The guard record id to check
+ *
+ * @return true if the given record id is valid else false
+ */
+bool isValidRecord(const uint32_t recordId);
+
 /**
  * @brief Wrapper function for libguard::getGuardFilePath
  *
@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "common/phal_devtree_utils.hpp"
+#include "hw_isolation_record/entry.hpp"
+#include "hw_isolation_record/openpower_guard_interface.hpp"
+
+#include <vector>
+
+namespace hw_isolation
+{
+namespace record
+{
+namespace diff
+{
+
+/**
+ * @brief The type of change between the isolated hardware entries and
+ *        the hardware isolation records.
+ */
+enum class ChangeType
+{
+    Added,
+    Removed,
+    SeverityChanged,
+    ErrorLogChanged
+};
+
+/**
+ * @brief Used to hold a single change that needs to apply on the isolated
+ *        hardware entries to reflect the hardware isolation records.
+ */
+struct Change
+{
+    /**
+     * @brief The type of change
+     */
+    ChangeType _type;
+
+    /**
+     * @brief The entry record id to apply the change.
+     *
+     * @note It will be the new record id for ChangeType::Added.
+     */
+    entry::EntryRecordId _entryRecordId;
+
+    /**
+     * @brief The record which caused the change.
+     *
+     * @note It won't be present for ChangeType::Removed.
+     */
+    std::optional<openpower_guard::GuardRecord> _record;
+};
+
+using ChangeSet = std::vector<Change>;
+
+/**
+ * @brief Used to hold the isolated hardware entry details which are
+ *        compared against the hardware isolation records.
+ */
+struct EntryState
+{
+    /**
+     * @brief The entry record id
+     */
+    entry::EntryRecordId _entryRecordId;
+
+    /**
+     * @brief The entry entity path raw data
+     */
+    devtree::DevTreePhysPath _entityPath;
+
+    /**
+     * @brief The entry severity
+     */
+    entry::EntrySeverity _severity;
+
+    /**
+     * @brief The entry error log id (aka EID)
+     */
+    entry::EntryErrLogId _errLogId;
+};
+
+using EntryStates = std::vector<EntryState>;
+
+/**
+ * @brief Used to get the details of the given isolated hardware entries
+ *        to compute the change set.
+ *
+ * @param[in] isolatedHardwares - the existing isolated hardware entries
+ *
+ * @return The entries details in the entry record id order
+ */
+EntryStates getEntryStates(const IsolatedHardwares& isolatedHardwares);
+
+/**
+ * @brief Used to compute the change set between the given isolated hardware
+ *        entries and the hardware isolation records.
+ *
+ * @details The records are keyed by their entity path once so, each entry
+ *          is compared against its record without scanning the whole
+ *          record list.
+ *
+ * @param[in] entryStates - the existing isolated hardware entries details
+ * @param[in] records - the hardware isolation records from the partition
+ *
+ * @return The change set which is ordered to apply i.e. Removed, then
+ *         SeverityChanged and ErrorLogChanged, then Added.
+ *         Empty if the entries are already reflecting the records.
+ */
+ChangeSet computeChangeSet(const EntryStates& entryStates,
+                           const openpower_guard::GuardRecords& records);
+
+} // namespace diff
+} // namespace record
+} // namespace hw_isolation
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/change_journal.hpp"
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+
+namespace hw_isolation
+{
+namespace journal
+{
+
+using namespace phosphor::logging;
+
+ChangeJournal::ChangeJournal(sdbusplus::bus::bus& bus,
+                             const std::string& objPath,
+                             const size_t capacity) :
+    type::ServerObject<ChangeJournalInterface>(bus, objPath.c_str()),
+    _capacity(std::max<size_t>(capacity, 1))
+{
+    // The journal is not persisted so, start from the current time in
+    // microseconds to keep the generations increasing across the restarts
+    // and, to make the clients which are using the generation of the
+    // previous instance to resync.
+    auto startGeneration = static_cast<Generation>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count());
+    _droppedGeneration = startGeneration;
+    generation(startGeneration, true);
+}
+
+void ChangeJournal::add(const ChangeType changeType,
+                        const sdbusplus::message::object_path& objPath)
+{
+    auto nextGeneration = generation() + 1;
+    if (_changes.size() == _capacity)
+    {
+        _droppedGeneration = std::get<0>(_changes.front());
+        _changes.pop_front();
+    }
+    _changes.emplace_back(nextGeneration, changeType, objPath);
+
+    // Skip the signal since the clients poll the changes.
+    generation(nextGeneration, true);
+}
+
+void ChangeJournal::resync()
+{
+    _changes.clear();
+
+    // Move to the next generation so that, the clients which are using
+    // the current generation also resync.
+    auto nextGeneration = generation() + 1;
+    _droppedGeneration = nextGeneration;
+    generation(nextGeneration, true);
+}
+
+Changes ChangeJournal::getChangesSince(Generation generation)
+{
+    auto latestGeneration = this->generation();
+    if ((generation < _droppedGeneration) || (generation > latestGeneration))
+    {
+        log<level::INFO>(
+            std::format("The changes since the generation [{}] are not "
+                        "available, the available generations are [{}-{}]",
+                        generation, _droppedGeneration, latestGeneration)
+                .c_str());
+        return std::make_tuple(true, latestGeneration, std::vector<Change>());
+    }
+
+    // The changes are in the generation order so, find the first change
+    // after the given generation.
+    auto changeIt = std::ranges::upper_bound(
+        _changes, generation, {},
+        [](const auto& change) { return std::get<0>(change); });
+
+    return std::make_tuple(false, latestGeneration,
+                           std::vector<Change>(changeIt, _changes.end()));
+}
+
+} // namespace journal
+} // namespace hw_isolation
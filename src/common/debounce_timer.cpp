@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/debounce_timer.hpp"
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <algorithm>
+#include <format>
+
+namespace hw_isolation
+{
+namespace debounce
+{
+
+using namespace phosphor::logging;
+
+DebounceTimer::DebounceTimer(const sdeventplus::Event& eventLoop,
+                             std::chrono::milliseconds quietPeriod,
+                             std::chrono::milliseconds maxLatency,
+                             DebounceHandler handler) :
+    _quietPeriod(quietPeriod), _maxLatency(std::max(quietPeriod, maxLatency)),
+    _handler(handler),
+    _timer(eventLoop,
+           std::bind(std::mem_fn(&DebounceTimer::onTimerExpired), this))
+{}
+
+void DebounceTimer::trigger()
+{
+    auto now = Clock::now();
+    if (!_firstPendingTrigger.has_value())
+    {
+        _firstPendingTrigger = now;
+    }
+    ++_pendingTriggers;
+    ++_stats._totalTriggers;
+
+    // Trailing edge i.e. wait for the quiet period from the last trigger
+    // but, not beyond the maximum latency from the first pending trigger.
+    auto deadline = std::min(now + _quietPeriod,
+                             *_firstPendingTrigger + _maxLatency);
+    auto remaining =
+        std::chrono::duration_cast<std::chrono::microseconds>(deadline - now);
+
+    _timer.restartOnce(std::max(remaining, std::chrono::microseconds(0)));
+}
+
+void DebounceTimer::flush()
+{
+    if (_pendingTriggers == 0)
+    {
+        return;
+    }
+
+    callHandler(false);
+}
+
+void DebounceTimer::cancel()
+{
+    _timer.setEnabled(false);
+    _firstPendingTrigger.reset();
+    _pendingTriggers = 0;
+}
+
+bool DebounceTimer::isPending() const
+{
+    return _pendingTriggers != 0;
+}
+
+const DebounceStats& DebounceTimer::getStats() const
+{
+    return _stats;
+}
+
+void DebounceTimer::onTimerExpired()
+{
+    if (_pendingTriggers == 0)
+    {
+        _timer.setEnabled(false);
+        return;
+    }
+
+    callHandler((Clock::now() - *_firstPendingTrigger) >= _maxLatency);
+}
+
+void DebounceTimer::callHandler(bool byMaxLatency)
+{
+    _timer.setEnabled(false);
+
+    _stats._lastCoalesced = _pendingTriggers;
+    _stats._maxCoalesced = std::max(_stats._maxCoalesced, _pendingTriggers);
+    ++_stats._totalFlushes;
+    if (byMaxLatency)
+    {
+        ++_stats._maxLatencyFlushes;
+    }
+
+    log<level::DEBUG>(
+        std::format("Debounced [{}] triggers (max [{}], total triggers [{}], "
+                    "total flushes [{}], max latency flushes [{}])",
+                    _stats._lastCoalesced, _stats._maxCoalesced,
+                    _stats._totalTriggers, _stats._totalFlushes,
+                    _stats._maxLatencyFlushes)
+            .c_str());
+
+    // Reset before calling the handler to allow retrigger from the handler
+    _firstPendingTrigger.reset();
+    _pendingTriggers = 0;
+
+    _handler();
+}
+
+} // namespace debounce
+} // namespace hw_isolation
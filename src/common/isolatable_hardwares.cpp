@@ -583,6 +583,15 @@ std::optional<std::vector<sdbusplus::message::object_path>>
     constexpr auto vpdMgrObjPath = "/com/ibm/VPD/Manager";
     constexpr auto vpdInterface = "com.ibm.VPD.Manager";
 
+    if (_inventoryLookupCacheEnabled)
+    {
+        if (auto cacheIt = _invPathsByLocCodeCache.find(unexpandedLocCode);
+            cacheIt != _invPathsByLocCodeCache.end())
+        {
+            return cacheIt->second;
+        }
+    }
+
     std::vector<sdbusplus::message::object_path> listOfInventoryObjPaths;
 
     try
@@ -612,9 +621,58 @@ std::optional<std::vector<sdbusplus::message::object_path>>
         return std::nullopt;
     }
 
+    if (_inventoryLookupCacheEnabled)
+    {
+        _invPathsByLocCodeCache.emplace(unexpandedLocCode,
+                                        listOfInventoryObjPaths);
+    }
+
     return listOfInventoryObjPaths;
 }
 
+std::optional<std::vector<sdbusplus::message::object_path>>
+    IsolatableHWs::getChildsInventoryPath(
+        const sdbusplus::message::object_path& parentObjPath,
+        const std::string& interfaceName)
+{
+    if (!_inventoryLookupCacheEnabled)
+    {
+        return utils::getChildsInventoryPath(_bus, parentObjPath,
+                                             interfaceName);
+    }
+
+    auto cacheKey = std::make_pair(parentObjPath.str, interfaceName);
+    if (auto cacheIt = _childsInvPathsCache.find(cacheKey);
+        cacheIt != _childsInvPathsCache.end())
+    {
+        return cacheIt->second;
+    }
+
+    auto childsInventoryPath =
+        utils::getChildsInventoryPath(_bus, parentObjPath, interfaceName);
+    if (childsInventoryPath.has_value())
+    {
+        _childsInvPathsCache.emplace(std::move(cacheKey),
+                                     *childsInventoryPath);
+    }
+    return childsInventoryPath;
+}
+
+void IsolatableHWs::enableInventoryLookupCache(bool enable)
+{
+    _inventoryLookupCacheEnabled = enable;
+    if (!enable)
+    {
+        _invPathsByLocCodeCache.clear();
+        _childsInvPathsCache.clear();
+    }
+}
+
+size_t IsolatableHWs::getNumOfCachedFRULookups() const
+{
+    return _invPathsByLocCodeCache.size();
+}
+
 std::optional<struct pdbg_target*>
     IsolatableHWs::getParentFruPhalDevTreeTgt(struct pdbg_target* devTreeTgt)
 {
@@ -741,8 +799,8 @@ std::optional<sdbusplus::message::object_path>
 
     constexpr auto MotherboardIface =
         "xyz.openbmc_project.Inventory.Item.Board.Motherboard";
-    auto parentFruPath = utils::getChildsInventoryPath(
-        _bus, std::string("/xyz/openbmc_project/inventory"), MotherboardIface);
+    auto parentFruPath = getChildsInventoryPath(
+        std::string("/xyz/openbmc_project/inventory"), MotherboardIface);
 
     if (!parentFruPath.has_value())
     {
@@ -964,9 +1022,8 @@ std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
                 return std::nullopt;
             }
 
-            auto childsInventoryPath = utils::getChildsInventoryPath(
-                _bus, *parentFruPath,
-                isolatedHwDetails->first._interfaceName._name);
+            auto childsInventoryPath = getChildsInventoryPath(
+                *parentFruPath, isolatedHwDetails->first._interfaceName._name);
             if (!childsInventoryPath.has_value())
             {
                 return std::nullopt;
@@ -1097,6 +1154,54 @@ std::optional<sdbusplus::message::object_path> IsolatableHWs::getInventoryPath(
     }
 }
 
+std::optional<LocationCode> IsolatableHWs::getFRULocationCode(
+    const devtree::DevTreePhysPath& physicalPath)
+{
+    try
+    {
+        auto isolatedHwTgt = devtree::getPhalDevTreeTgt(physicalPath);
+        if (!isolatedHwTgt.has_value())
+        {
+            return std::nullopt;
+        }
+
+        auto pdbgTgtClass{pdbg_target_class_name(*isolatedHwTgt)};
+        if (pdbgTgtClass == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        auto isolatedHwDetails =
+            getIsotableHWDetails(IsolatableHWs::HW_Details::HwId{
+                IsolatableHWs::HW_Details::HwId::PhalPdbgClassName(
+                    pdbgTgtClass)});
+        if (!isolatedHwDetails.has_value())
+        {
+            return std::nullopt;
+        }
+
+        if (isolatedHwDetails->second._isItFRU)
+        {
+            return devtree::getFRUDetails(*isolatedHwTgt).first;
+        }
+
+        auto parentFruTgt = getParentFruPhalDevTreeTgt(*isolatedHwTgt);
+        if (!parentFruTgt.has_value())
+        {
+            return std::nullopt;
+        }
+        return devtree::getFRUDetails(*parentFruTgt).first;
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(std::format("Exception [{}] to get the FRU location "
+                                    "code",
+                                    e.what())
+                            .c_str());
+        return std::nullopt;
+    }
+}
+
 } // namespace isolatable_hws
 
 namespace inv_path_lookup_func
@@ -15,7 +15,9 @@ extern "C"
 
 #include <phosphor-logging/elog-errors.hpp>
 
+#include <filesystem>
 #include <format>
+#include <fstream>
 #include <iomanip>
 #include <sstream>
 #include <stdexcept>
@@ -359,6 +361,49 @@ bool isECOcore(struct pdbg_target* coreTgt)
     }
 }
 
+uint64_t getDevTreeGeneration()
+{
+    std::error_code ec;
+    auto devTreeSize = std::filesystem::file_size(PHAL_DEVTREE, ec);
+    if (ec)
+    {
+        log<level::ERR>(std::format("Failed [{}] to get the size of [{}] to "
+                                    "get the device tree generation",
+                                    ec.message(), PHAL_DEVTREE)
+                            .c_str());
+        return 0;
+    }
+
+    // The device tree attributes are updated in place (for example, the
+    // hardware state) so, only the size is considered along with the BMC
+    // firmware version. The in place updates of the attributes which are
+    // used to resolve the paths are caught by the background validation
+    // of the persisted paths.
+    std::string bmcVersion;
+    std::ifstream osRelease("/etc/os-release");
+    for (std::string line; std::getline(osRelease, line);)
+    {
+        if (line.starts_with("VERSION_ID="))
+        {
+            bmcVersion = line;
+            break;
+        }
+    }
+
+    // The generation is persisted so, use the hash which is stable across
+    // the builds (FNV-1a 64 bit) instead of std::hash.
+    constexpr uint64_t fnvOffsetBasis = 0xcbf29ce484222325;
+    constexpr uint64_t fnvPrime = 0x100000001b3;
+
+    uint64_t generation{fnvOffsetBasis};
+    for (const auto& byte : std::format("{}:{}", bmcVersion, devTreeSize))
+    {
+        generation ^= static_cast<uint8_t>(byte);
+        generation *= fnvPrime;
+    }
+    return generation;
+}
+
 namespace lookup_func
 {
 CanGetPhysPath mruId(struct pdbg_target* pdbgTgt, InstanceId instanceId,
@@ -7,6 +7,7 @@
 
 #include <xyz/openbmc_project/State/Chassis/server.hpp>
 
+#include <chrono>
 #include <unordered_set>
 
 namespace hw_isolation
@@ -248,6 +249,159 @@ void setEnabledProperty(sdbusplus::bus::bus& bus,
     }
 }
 
+/**
+ * @brief Helper function to get the common parent path of the given
+ *        object paths.
+ *
+ * @param[in] dbusObjPaths - The object paths, must not be empty
+ *
+ * @return The common parent path, "/" if nothing is common
+ */
+static std::string
+    getCommonParentPath(const std::vector<std::string>& dbusObjPaths)
+{
+    auto commonPath = dbusObjPaths.front().substr(
+        0, dbusObjPaths.front().rfind('/'));
+    for (const auto& dbusObjPath : dbusObjPaths)
+    {
+        // Trim the common path until it is the parent of the given path
+        while (!commonPath.empty() &&
+               !dbusObjPath.starts_with(commonPath + "/"))
+        {
+            commonPath.erase(commonPath.rfind('/'));
+        }
+    }
+    return commonPath.empty() ? "/" : commonPath;
+}
+
+void setEnabledProperties(sdbusplus::bus::bus& bus,
+                          const std::vector<std::string>& dbusObjPaths,
+                          bool enabledPropVal)
+{
+    if (dbusObjPaths.empty())
+    {
+        return;
+    }
+
+    if (dbusObjPaths.size() == 1)
+    {
+        // Mapper GetObject is enough for the single object.
+        setEnabledProperty(bus, dbusObjPaths.front(), enabledPropVal);
+        return;
+    }
+
+    constexpr auto enabledPropIface = "xyz.openbmc_project.Object.Enable";
+    constexpr auto enabledPropName = "Enabled";
+    constexpr auto inventoryMgrService =
+        "xyz.openbmc_project.Inventory.Manager";
+    const std::string inventryMgrObjPath{"/xyz/openbmc_project/inventory"};
+
+    // Get the objects which are implemented the enabled property along with
+    // their services by using single mapper call on the common parent of
+    // the given objects instead of the whole inventory.
+    std::map<std::string, std::map<std::string, std::vector<std::string>>>
+        enabledPropObjs;
+    try
+    {
+        auto method = bus.new_method_call(type::ObjectMapperName,
+                                          type::ObjectMapperPath,
+                                          type::ObjectMapperName, "GetSubTree");
+        method.append(getCommonParentPath(dbusObjPaths), 0,
+                      std::vector<std::string>({enabledPropIface}));
+
+        auto reply = bus.call(method);
+        reply.read(enabledPropObjs);
+    }
+    catch (const sdbusplus::exception::SdBusError& e)
+    {
+        log<level::ERR>(
+            std::format("Exception [{}] to get the objects which are "
+                        "implemented the enabled property, so setting "
+                        "the property for each object",
+                        e.what())
+                .c_str());
+        std::ranges::for_each(dbusObjPaths, [&bus, enabledPropVal](
+                                                const auto& dbusObjPath) {
+            setEnabledProperty(bus, dbusObjPath, enabledPropVal);
+        });
+        return;
+    }
+
+    using PropertyValue = std::variant<bool>;
+    using PropertyMap = std::map<std::string, PropertyValue>;
+    using InterfaceMap = std::map<std::string, PropertyMap>;
+    using ObjectValueTree =
+        std::map<sdbusplus::message::object_path, InterfaceMap>;
+
+    ObjectValueTree objectValueTree;
+    for (const auto& dbusObjPath : dbusObjPaths)
+    {
+        auto objIt = enabledPropObjs.find(dbusObjPath);
+        if ((objIt == enabledPropObjs.end()) || objIt->second.empty())
+        {
+            // Enabled property is not implemented for the given object.
+            continue;
+        }
+
+        // Use the inventory manager "Notify" only if it hosts the object,
+        // otherwise set the property through the hosting service.
+        if (!objIt->second.contains(inventoryMgrService) ||
+            !dbusObjPath.starts_with(inventryMgrObjPath + "/"))
+        {
+            try
+            {
+                setDBusPropertyVal<bool>(bus, dbusObjPath, enabledPropIface,
+                                         enabledPropName, enabledPropVal);
+            }
+            catch (const sdbusplus::exception::SdBusError& e)
+            {
+                // Refer setEnabledProperty to know why the exception
+                // is ignored.
+                log<level::ERR>(
+                    std::format("Exception [{}], failed to set enable D-Bus "
+                                "property for [{}]",
+                                e.what(), dbusObjPath)
+                        .c_str());
+            }
+            continue;
+        }
+
+        PropertyMap propertyMap;
+        propertyMap.emplace(enabledPropName, enabledPropVal);
+        InterfaceMap interfaceMap;
+        interfaceMap.emplace(enabledPropIface, std::move(propertyMap));
+
+        // Remove PIM root object path in the given object path
+        // to avoid wrong object tree under the PIM root object path.
+        std::string objPath(dbusObjPath);
+        objPath.erase(0, inventryMgrObjPath.length());
+        objectValueTree.emplace(std::move(objPath), std::move(interfaceMap));
+    }
+
+    if (objectValueTree.empty())
+    {
+        return;
+    }
+
+    auto numOfObjs = objectValueTree.size();
+    try
+    {
+        auto method = bus.new_method_call(
+            inventoryMgrService, inventryMgrObjPath.c_str(),
+            "xyz.openbmc_project.Inventory.Manager", "Notify");
+        method.append(std::move(objectValueTree));
+        bus.call_noreply(method);
+    }
+    catch (const sdbusplus::exception::SdBusError& e)
+    {
+        log<level::ERR>(
+            std::format("Exception [{}], failed to set enable D-Bus property "
+                        "for [{}] objects",
+                        e.what(), numOfObjs)
+                .c_str());
+    }
+}
+
 std::optional<sdbusplus::message::object_path>
     getBMCLogPath(sdbusplus::bus::bus& bus, const uint32_t eid,
                   bool createPELWithError)
@@ -297,6 +451,138 @@ std::optional<sdbusplus::message::object_path>
     }
 }
 
+std::vector<sdbusplus::slot_t>
+    requestBMCLogPaths(sdbusplus::bus::bus& bus, const std::set<uint32_t>& eids,
+                       BMCLogPathCallback callback)
+{
+    std::vector<sdbusplus::slot_t> pendingCalls;
+
+    std::string dbusServiceName;
+    try
+    {
+        dbusServiceName = utils::getDBusServiceName(
+            bus, type::LoggingObjectPath, type::LoggingInterface);
+    }
+    catch (const sdbusplus::exception::SdBusError& e)
+    {
+        log<level::ERR>(
+            std::format("Exception [{}] when trying to get BMC log paths "
+                        "for [{}] EIDs (aka PEL ID), removing the PEL "
+                        "associations",
+                        e.what(), eids.size())
+                .c_str());
+        std::ranges::for_each(eids, [&callback](const auto& eid) {
+            callback(eid, sdbusplus::message::object_path());
+        });
+        return pendingCalls;
+    }
+
+    // The replies timeout, so the callback is called for all requests.
+    constexpr uint64_t replyTimeoutUs = 25 * 1000 * 1000;
+
+    for (const auto& eid : eids)
+    {
+        if (eid == 0)
+        {
+            // If EID is "0" means, no bmc error log.
+            callback(eid, sdbusplus::message::object_path());
+            continue;
+        }
+
+        try
+        {
+            auto method = bus.new_method_call(
+                dbusServiceName.c_str(), type::LoggingObjectPath,
+                type::LoggingInterface, "GetBMCLogIdFromPELId");
+            method.append(static_cast<uint32_t>(eid));
+
+            pendingCalls.emplace_back(bus.call_async(
+                method,
+                [eid, callback](sdbusplus::message::message& reply) {
+                if (reply.is_method_error())
+                {
+                    log<level::ERR>(
+                        std::format("Failed to get BMC log path for the given "
+                                    "EID (aka PEL ID) [{}], removing the PEL "
+                                    "association",
+                                    eid)
+                            .c_str());
+                    callback(eid, sdbusplus::message::object_path());
+                    return;
+                }
+
+                uint32_t bmcLogId;
+                reply.read(bmcLogId);
+                callback(eid, sdbusplus::message::object_path(
+                                  std::string(type::LoggingObjectPath) +
+                                  "/entry/" + std::to_string(bmcLogId)));
+            },
+                replyTimeoutUs));
+        }
+        catch (const sdbusplus::exception::SdBusError& e)
+        {
+            log<level::ERR>(
+                std::format("Exception [{}] when trying to get BMC log path "
+                            "for the given EID (aka PEL ID) [{}], removing "
+                            "the PEL association",
+                            e.what(), eid)
+                    .c_str());
+            callback(eid, sdbusplus::message::object_path());
+        }
+    }
+
+    return pendingCalls;
+}
+
+std::map<uint32_t, sdbusplus::message::object_path>
+    getBMCLogPaths(const std::set<uint32_t>& eids)
+{
+    // The private connection won't have any matches and objects attached
+    // so, processing it won't dispatch anything other than the below replies.
+    auto bus = sdbusplus::bus::new_bus();
+
+    std::map<uint32_t, sdbusplus::message::object_path> bmcLogPaths;
+    size_t pendingReplies{eids.size()};
+
+    auto pendingCalls = requestBMCLogPaths(
+        bus, eids,
+        [&bmcLogPaths, &pendingReplies](
+            uint32_t eid, const sdbusplus::message::object_path& bmcLogPath) {
+        bmcLogPaths.insert_or_assign(eid, bmcLogPath);
+        --pendingReplies;
+    });
+
+    // Beyond the reply timeout of the requests, just to never block forever
+    constexpr auto maxWait = std::chrono::seconds(30);
+    const auto deadline = std::chrono::steady_clock::now() + maxWait;
+
+    while (pendingReplies > 0)
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= deadline)
+        {
+            log<level::ERR>(
+                std::format("Timed out to get BMC log object path for [{}] "
+                            "EID (aka PEL ID), removing the PEL association",
+                            pendingReplies)
+                    .c_str());
+            break;
+        }
+
+        bus.wait(std::chrono::duration_cast<std::chrono::microseconds>(
+            deadline - now));
+        while (bus.process_discard())
+        {}
+    }
+
+    for (const auto& eid : eids)
+    {
+        bmcLogPaths.try_emplace(eid, sdbusplus::message::object_path());
+    }
+
+    return bmcLogPaths;
+}
+
 std::optional<type::InstanceId> getInstanceId(const std::string& objPathSegment)
 {
     try
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/write_behind.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <cstring>
+#include <format>
+
+namespace hw_isolation
+{
+namespace persist
+{
+
+using namespace phosphor::logging;
+
+/**
+ * @brief The quiet period after the last update to write the updates
+ */
+constexpr std::chrono::milliseconds WriteQuietPeriod{100};
+
+bool syncPath(const fs::path& path)
+{
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        log<level::ERR>(std::format("Failed [{}] to open [{}] to sync",
+                                    strerror(errno), path.string())
+                            .c_str());
+        return false;
+    }
+
+    bool synced{fsync(fd) == 0};
+    if (!synced)
+    {
+        log<level::ERR>(std::format("Failed [{}] to sync [{}]",
+                                    strerror(errno), path.string())
+                            .c_str());
+    }
+    close(fd);
+    return synced;
+}
+
+bool replaceFile(const fs::path& tmpPath, const fs::path& path)
+{
+    if (!syncPath(tmpPath))
+    {
+        return false;
+    }
+
+    std::error_code ec;
+    fs::rename(tmpPath, path, ec);
+    if (ec)
+    {
+        log<level::ERR>(std::format("Failed [{}] to replace [{}] by [{}]",
+                                    ec.message(), path.string(),
+                                    tmpPath.string())
+                            .c_str());
+        return false;
+    }
+
+    return syncPath(path.parent_path());
+}
+
+std::optional<fs::path> keepAside(const fs::path& path)
+{
+    auto asidePath = fs::path(path).concat(".unsupported");
+
+    std::error_code ec;
+    fs::rename(path, asidePath, ec);
+    if (ec)
+    {
+        log<level::ERR>(std::format("Failed [{}] to keep [{}] aside as [{}]",
+                                    ec.message(), path.string(),
+                                    asidePath.string())
+                            .c_str());
+        return std::nullopt;
+    }
+
+    syncPath(path.parent_path());
+    return asidePath;
+}
+
+WriteBehind::WriteBehind(const sdeventplus::Event& eventLoop,
+                         std::chrono::milliseconds maxLatency) :
+    _writeTimer(eventLoop, WriteQuietPeriod, maxLatency,
+                std::bind(std::mem_fn(&WriteBehind::writeDirty), this))
+{}
+
+WriterId WriteBehind::addWriter(Writer writer)
+{
+    _writers.emplace_back(std::move(writer));
+    return _writers.size() - 1;
+}
+
+void WriteBehind::markDirty(const WriterId writerId)
+{
+    if (_shutdown)
+    {
+        return;
+    }
+
+    _dirtyWriters.emplace(writerId);
+    _writeTimer.trigger();
+}
+
+void WriteBehind::flush()
+{
+    _writeTimer.cancel();
+    writeDirty();
+}
+
+void WriteBehind::shutdown()
+{
+    flush();
+    _shutdown = true;
+}
+
+void WriteBehind::writeDirty()
+{
+    if (_dirtyWriters.empty())
+    {
+        return;
+    }
+
+    // The writers might mark dirty again while writing (for example,
+    // compaction) so, take the current batch.
+    auto dirtyWriters = std::move(_dirtyWriters);
+    _dirtyWriters.clear();
+    for (const auto& writerId : dirtyWriters)
+    {
+        _writers[writerId]();
+    }
+}
+
+} // namespace persist
+} // namespace hw_isolation
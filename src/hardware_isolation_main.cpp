@@ -2,13 +2,20 @@
 
 #include "config.h"
 
+#include "common/change_journal.hpp"
+#include "common/restore_status.hpp"
 #include "common/utils.hpp"
+#include "common/write_behind.hpp"
 #include "hw_isolation_event/hw_status_manager.hpp"
 #include "hw_isolation_record/manager.hpp"
 
 #include <phosphor-logging/elog-errors.hpp>
 #include <sdeventplus/event.hpp>
+#include <sdeventplus/source/signal.hpp>
 
+#include <chrono>
+#include <csignal>
+#include <filesystem>
 #include <format>
 
 int main()
@@ -28,17 +35,98 @@ int main()
         sdbusplus::server::manager::manager objManager(bus,
                                                        HW_ISOLATION_OBJPATH);
 
+        // Stop the event loop on the termination signals to write
+        // the pending persisted data before exit.
+        sigset_t signalMask;
+        sigemptyset(&signalMask);
+        sigaddset(&signalMask, SIGTERM);
+        sigaddset(&signalMask, SIGINT);
+        sigprocmask(SIG_BLOCK, &signalMask, nullptr);
+        auto exitEventLoop = [&event](sdeventplus::source::Signal&,
+                                      const struct signalfd_siginfo*) {
+            event.exit(0);
+        };
+        sdeventplus::source::Signal sigTermSource(event, SIGTERM,
+                                                  exitEventLoop);
+        sdeventplus::source::Signal sigIntSource(event, SIGINT, exitEventLoop);
+
+        // Used to persist the entries and the events from the event loop.
+        hw_isolation::persist::WriteBehind writeBehind(
+            event,
+            std::chrono::milliseconds(PERSIST_WRITE_BEHIND_MAX_LATENCY_MS));
+
+        // Used to publish the entries and the events changes to the clients,
+        // it must be declared before the managers to destroy after them.
+        hw_isolation::journal::ChangeJournal changeJournal(
+            bus, HW_ISOLATION_OBJPATH, CHANGE_JOURNAL_CAPACITY);
+
         hw_isolation::record::Manager record_mgr(bus, HW_ISOLATION_OBJPATH,
-                                                 event);
+                                                 event, writeBehind);
+
+        record_mgr.subscribe(
+            [&changeJournal](const hw_isolation::record::EntryChange& change) {
+            using hw_isolation::record::EntryChangeType;
+            using hw_isolation::journal::ChangeType;
 
-        // Restore the isolated hardwares from their persisted location.
-        record_mgr.restore();
+            auto entryObjPath = std::filesystem::path(
+                                    HW_ISOLATION_ENTRY_OBJPATH) /
+                                std::to_string(change._entryRecordId);
+            switch (change._type)
+            {
+                case EntryChangeType::Added:
+                    changeJournal.add(ChangeType::EntryAdded,
+                                      entryObjPath.string());
+                    break;
+                case EntryChangeType::Resolved:
+                    // The resolved entries are removed
+                    changeJournal.add(ChangeType::EntryRemoved,
+                                      entryObjPath.string());
+                    break;
+                default:
+                    changeJournal.add(ChangeType::EntryUpdated,
+                                      entryObjPath.string());
+                    break;
+            }
+        });
 
-        hw_isolation::event::hw_status::Manager hwStatusMgr(bus, event,
-                                                            record_mgr);
+        // Used to publish the restore progress of the managers.
+        hw_isolation::restore_status::RestoreStatus restoreStatus(
+            bus, HW_ISOLATION_OBJPATH);
 
+#if !EARLY_BUS_NAME_CLAIM
+        // Restore the isolated hardwares from their persisted location
+        // before watching the host state to refresh the hardware status.
+        record_mgr.restore(restoreStatus);
+#endif
+
+        hw_isolation::event::hw_status::Manager hwStatusMgr(
+            bus, event, record_mgr, writeBehind, changeJournal);
+
+#if EARLY_BUS_NAME_CLAIM
+        /**
+         * The name is claimed before restoring the existing objects so that,
+         * the clients can talk to the service while restoring. The clients
+         * can check the restore progress by using the RestoreStatus
+         * interface and, the requests which are conflicting with the
+         * restore will complete the restore before serving.
+         */
+        bus.request_name(HW_ISOLATION_BUSNAME);
+
+        // Restore the isolated hardwares from their persisted location
+        // from the event loop, and then the hardware status event.
+        record_mgr.restoreIncrementally(restoreStatus, [&]() {
+            hwStatusMgr.restore(restoreStatus);
+
+            // The clients which got the objects while restoring should
+            // resync since, the restored objects are not journaled.
+            changeJournal.resync();
+        });
+#else
         // Restore the hardware status event from their persisted location.
-        hwStatusMgr.restore();
+        hwStatusMgr.restore(restoreStatus);
+
+        // The restored objects are not journaled.
+        changeJournal.resync();
 
         /**
          * The name should be claimed after the D-Bus service is fully
@@ -46,10 +134,15 @@ int main()
          * since we are restoring the existing object.
          */
         bus.request_name(HW_ISOLATION_BUSNAME);
+#endif
 
         // The below statement should be last to enter this app into the loop
         // to process D-Bus services.
         eventLoopRet = event.loop();
+
+        // The entries and the events will be removed from the bus while
+        // exiting, and those should not be removed from the persisted data.
+        writeBehind.shutdown();
     }
     catch (std::exception& e)
     {
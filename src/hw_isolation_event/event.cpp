@@ -2,31 +2,18 @@
 
 #include "hw_isolation_event/event.hpp"
 
-#include <cereal/archives/binary.hpp>
-#include <phosphor-logging/elog-errors.hpp>
-
 #include <ctime>
-#include <filesystem>
-#include <format>
-#include <fstream>
-
-// Associate Event Class with version number
-constexpr uint32_t Cereal_EventClassVersion = 1;
-CEREAL_CLASS_VERSION(hw_isolation::event::Event, Cereal_EventClassVersion);
 
 namespace hw_isolation
 {
 namespace event
 {
-namespace fs = std::filesystem;
-
-using namespace phosphor::logging;
 
 Event::Event(sdbusplus::bus::bus& bus, const std::string& objPath,
              const EventId eventId, const EventSeverity eventSeverity,
              const EventMsg& eventMsg,
              const type::AssociationDef& associationDef,
-             const bool reqDeserialize) :
+             const std::optional<uint64_t>& restoredTimeStamp) :
     type::ServerObject<EventInterface, AssociationDefInterface>(
         bus, objPath.c_str(),
         type::ServerObject<EventInterface,
@@ -37,77 +24,76 @@ Event::Event(sdbusplus::bus::bus& bus, const std::string& objPath,
     message(eventMsg);
     severity(eventSeverity);
 
-    // Set creation time of the event
-    std::time_t timeStamp = std::time(nullptr);
-    timestamp(timeStamp);
-
     // Add the associations which contain other required objects path
     // that helps event object consumer to pull other additional information
     // of this event
     associations(associationDef);
 
-    if (reqDeserialize)
+    if (restoredTimeStamp.has_value())
     {
-        deserialize();
+        // Skip to send property change signal in the restore path.
+        timestamp(*restoredTimeStamp, true);
     }
     else
     {
+        // Set creation time of the event
+        std::time_t timeStamp = std::time(nullptr);
+        timestamp(timeStamp);
+
         // Emit the signal for the event object creation since it deferred
-        // in interface constructor
+        // in interface constructor. The signal is not sent for the restored
+        // events.
         this->emit_object_added();
-
-        serialize();
     }
 }
 
-Event::~Event()
+Event::~Event() = default;
+
+EventId Event::getEventId() const
 {
-    fs::path path{std::format(HW_ISOLATION_EVENT_PERSIST_PATH, _eventId)};
-    if (fs::exists(path))
-    {
-        fs::remove(path);
-    }
+    return _eventId;
 }
 
-void Event::serialize()
+std::string Event::getHwInventoryPath() const
 {
-    fs::path path{std::format(HW_ISOLATION_EVENT_PERSIST_PATH, _eventId)};
-    try
-    {
-        std::ofstream os(path.c_str(), std::ios::binary);
-        cereal::BinaryOutputArchive oarchive(os);
-        oarchive(*this);
-    }
-    catch (const cereal::Exception& e)
+    for (const auto& [fwdType, revType, objPath] : associations())
     {
-        log<level::ERR>(std::format("Exception: [{}] during serialize the "
-                                    "hardware isolation status event into {}",
-                                    e.what(), path.string())
-                            .c_str());
-        fs::remove(path);
+        if (fwdType == "event_indicator")
+        {
+            return objPath;
+        }
     }
+    return std::string();
 }
 
-void Event::deserialize()
+std::string Event::getBmcErrorLogPath() const
 {
-    fs::path path{std::format(HW_ISOLATION_EVENT_PERSIST_PATH, _eventId)};
-    try
+    for (const auto& [fwdType, revType, objPath] : associations())
     {
-        if (fs::exists(path))
+        if (fwdType == "error_log")
         {
-            std::ifstream is(path.c_str(), std::ios::in | std::ios::binary);
-            cereal::BinaryInputArchive iarchive(is);
-            iarchive(*this);
+            return objPath;
         }
     }
-    catch (const cereal::Exception& e)
+    return std::string();
+}
+
+bool Event::update(const EventSeverity eventSeverity, const EventMsg& eventMsg,
+                   const type::AssociationDef& associationDef)
+{
+    if ((severity() == eventSeverity) && (message() == eventMsg) &&
+        (associations() == associationDef))
     {
-        log<level::ERR>(std::format("Exception: [{}] during deserialize the "
-                                    "hardware isolation status event from {}",
-                                    e.what(), path.string())
-                            .c_str());
-        fs::remove(path);
+        return false;
     }
+
+    message(eventMsg);
+    severity(eventSeverity);
+    associations(associationDef);
+
+    std::time_t timeStamp = std::time(nullptr);
+    timestamp(timeStamp);
+    return true;
 }
 
 } // namespace event
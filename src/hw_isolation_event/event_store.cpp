@@ -0,0 +1,353 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hw_isolation_event/event_store.hpp"
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/tuple.hpp>
+#include <cereal/types/vector.hpp>
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <stdexcept>
+
+namespace hw_isolation
+{
+namespace event
+{
+namespace event_store
+{
+
+using namespace phosphor::logging;
+
+/**
+ * @brief The store header magic ("HWES") and the store format version
+ *
+ * @note The event id counter must follow the version in all the versions
+ *       to keep the ids increasing even if the store is unsupported.
+ */
+constexpr uint32_t StoreMagic = 0x48574553;
+constexpr uint32_t StoreVersion = 1;
+
+EventStore::EventStore(const fs::path& storePath,
+                       const fs::path& legacyDirPath, const size_t capacity,
+                       persist::WriteBehind& writeBehind) :
+    _storePath(storePath), _capacity(capacity), _writeBehind(writeBehind),
+    _writerId(_writeBehind.addWriter(
+        std::bind(std::mem_fn(&EventStore::write), this)))
+{
+    fs::create_directories(_storePath.parent_path());
+
+    load();
+    auto importedFiles = importLegacyEvents(legacyDirPath);
+
+    if (evictOldestEvents().has_value())
+    {
+        log<level::INFO>(
+            std::format("Dropped the oldest hardware status events to keep "
+                        "the store capacity [{}]",
+                        _capacity)
+                .c_str());
+    }
+
+    write();
+    if (_dirty)
+    {
+        // Keep the legacy files to import again
+        return;
+    }
+
+    // Remove the legacy files only once the imported events are durable
+    // in the store, and keep the files which are failed to import.
+    std::error_code ec;
+    for (const auto& file : importedFiles)
+    {
+        fs::remove(file, ec);
+    }
+    if (fs::exists(legacyDirPath, ec) && fs::is_empty(legacyDirPath, ec))
+    {
+        fs::remove(legacyDirPath, ec);
+    }
+}
+
+void EventStore::load()
+{
+    if (!fs::exists(_storePath))
+    {
+        return;
+    }
+
+    bool unreadable{false};
+    try
+    {
+        std::ifstream is(_storePath, std::ios::in | std::ios::binary);
+        cereal::BinaryInputArchive iarchive(is);
+
+        uint32_t magic{0};
+        uint32_t version{0};
+        iarchive(magic, version);
+        if ((magic != StoreMagic) || (version != StoreVersion))
+        {
+            log<level::ERR>(
+                std::format("Ignoring the hardware status event store [{}] "
+                            "due to unsupported header, magic [{:#x}] "
+                            "version [{}]",
+                            _storePath.string(), magic, version)
+                    .c_str());
+            unreadable = true;
+            if (magic == StoreMagic)
+            {
+                // Continue with the ids of the unsupported version
+                iarchive(_lastEventId);
+            }
+        }
+        else
+        {
+            uint64_t numOfEvents{0};
+            iarchive(_lastEventId, numOfEvents);
+            for (uint64_t i = 0; i < numOfEvents; ++i)
+            {
+                EventId eventId{0};
+                uint8_t severity{0};
+                PersistedEvent event;
+                iarchive(eventId, severity, event._timestamp, event._message,
+                         event._hwInventoryPath, event._bmcErrorLogPath);
+                event._severity = static_cast<EventSeverity>(severity);
+                _events.insert_or_assign(eventId, std::move(event));
+            }
+        }
+    }
+    catch (const cereal::Exception& e)
+    {
+        log<level::ERR>(std::format("Exception: [{}] during load the "
+                                    "hardware status event store from {}, "
+                                    "loaded [{}] events",
+                                    e.what(), _storePath.string(),
+                                    _events.size())
+                            .c_str());
+        unreadable = true;
+    }
+
+    if (unreadable)
+    {
+        // Keep the unreadable store instead of overwriting its events by
+        // the new store, and never reuse the ids of the loaded events.
+        if (!_events.empty())
+        {
+            _lastEventId = std::max(_lastEventId, _events.rbegin()->first);
+        }
+        persist::keepAside(_storePath);
+        _dirty = true;
+    }
+}
+
+std::vector<fs::path>
+    EventStore::importLegacyEvents(const fs::path& legacyDirPath)
+{
+    std::vector<fs::path> importedFiles;
+    if (!fs::exists(legacyDirPath))
+    {
+        return importedFiles;
+    }
+
+    for (const auto& file : fs::directory_iterator(legacyDirPath))
+    {
+        try
+        {
+            auto eventId =
+                static_cast<EventId>(std::stoul(file.path().filename()));
+
+            std::ifstream is(file.path(), std::ios::in | std::ios::binary);
+            cereal::BinaryInputArchive iarchive(is);
+
+            // The per event file contains the Event class version
+            // and then the event members.
+            uint32_t classVersion{0};
+            PersistedEvent event;
+            type::AssociationDef associations;
+            iarchive(classVersion, event._message, event._severity,
+                     event._timestamp, associations);
+
+            for (const auto& [fwdType, revType, objPath] : associations)
+            {
+                if (fwdType == "event_indicator")
+                {
+                    event._hwInventoryPath = objPath;
+                }
+                else if (fwdType == "error_log")
+                {
+                    event._bmcErrorLogPath = objPath;
+                }
+            }
+
+            _events.insert_or_assign(eventId, std::move(event));
+            _lastEventId = std::max(_lastEventId, eventId);
+            importedFiles.emplace_back(file.path());
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(
+                std::format("Exception: [{}] during import the hardware "
+                            "status event from {}",
+                            e.what(), file.path().string())
+                    .c_str());
+        }
+    }
+
+    _dirty = true;
+    return importedFiles;
+}
+
+const PersistedEvents& EventStore::getEvents() const
+{
+    return _events;
+}
+
+EventId EventStore::allocateEventId()
+{
+    markDirty();
+    return ++_lastEventId;
+}
+
+std::optional<EventId> EventStore::put(const EventId eventId,
+                                       const PersistedEvent& event)
+{
+    _events.insert_or_assign(eventId, event);
+    markDirty();
+
+    return evictOldestEvents(eventId);
+}
+
+void EventStore::erase(const EventId eventId)
+{
+    if (_events.erase(eventId) != 0)
+    {
+        markDirty();
+    }
+}
+
+void EventStore::clear()
+{
+    if (!_events.empty())
+    {
+        _events.clear();
+        markDirty();
+    }
+}
+
+size_t EventStore::getCapacity() const
+{
+    return _capacity;
+}
+
+size_t EventStore::getNumOfEvictedEvents() const
+{
+    return _numOfEvictedEvents;
+}
+
+size_t EventStore::getMemoryUsage() const
+{
+    size_t memoryUsage{sizeof(*this)};
+    for (const auto& [eventId, event] : _events)
+    {
+        // Approximate the map node overhead by the three node pointers
+        memoryUsage += sizeof(eventId) + sizeof(event) + 3 * sizeof(void*) +
+                       event._message.capacity() +
+                       event._hwInventoryPath.capacity() +
+                       event._bmcErrorLogPath.capacity();
+    }
+    return memoryUsage;
+}
+
+std::optional<EventId>
+    EventStore::evictOldestEvents(std::optional<EventId> keepEventId)
+{
+    std::optional<EventId> evictedEventId;
+    while (_events.size() > _capacity)
+    {
+        // The ids are allocated in the increasing order so, the first one
+        // is the oldest event. The Ok severity events are evicted first
+        // since, those are not reporting any hardware problem.
+        auto evictIt = std::ranges::find_if(
+            _events, [&keepEventId](const auto& event) {
+            return (event.first != keepEventId) &&
+                   (event.second._severity == EventSeverity::Ok);
+        });
+        if (evictIt == _events.end())
+        {
+            evictIt = std::ranges::find_if(
+                _events, [&keepEventId](const auto& event) {
+                return event.first != keepEventId;
+            });
+        }
+        if (evictIt == _events.end())
+        {
+            break;
+        }
+
+        evictedEventId = evictIt->first;
+        _events.erase(evictIt);
+        ++_numOfEvictedEvents;
+        _dirty = true;
+    }
+    return evictedEventId;
+}
+
+void EventStore::markDirty()
+{
+    _dirty = true;
+    _writeBehind.markDirty(_writerId);
+}
+
+void EventStore::write()
+{
+    if (!_dirty)
+    {
+        return;
+    }
+
+    // Write into the temporary file and rename to avoid losing the events
+    // if failed in between.
+    auto tmpStorePath = fs::path(_storePath).concat(".tmp");
+    try
+    {
+        {
+            std::ofstream os(tmpStorePath, std::ios::binary | std::ios::trunc);
+            cereal::BinaryOutputArchive oarchive(os);
+
+            oarchive(StoreMagic, StoreVersion, _lastEventId,
+                     static_cast<uint64_t>(_events.size()));
+            for (const auto& [eventId, event] : _events)
+            {
+                oarchive(eventId, static_cast<uint8_t>(event._severity),
+                         event._timestamp, event._message,
+                         event._hwInventoryPath, event._bmcErrorLogPath);
+            }
+            os.flush();
+            if (!os.good())
+            {
+                throw std::runtime_error("Failed to write the store file");
+            }
+        }
+        if (!persist::replaceFile(tmpStorePath, _storePath))
+        {
+            throw std::runtime_error("Failed to replace the store file");
+        }
+        _dirty = false;
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(std::format("Exception: [{}] during write the "
+                                    "hardware status event store into {}",
+                                    e.what(), _storePath.string())
+                            .c_str());
+        std::error_code ec;
+        fs::remove(tmpStorePath, ec);
+    }
+}
+
+} // namespace event_store
+} // namespace event
+} // namespace hw_isolation
@@ -16,6 +16,7 @@ extern "C"
 
 #include <phosphor-logging/elog-errors.hpp>
 
+#include <algorithm>
 #include <filesystem>
 #include <format>
 
@@ -40,6 +41,11 @@ namespace fs = std::filesystem;
 constexpr auto HW_STATUS_EVENTS_PATH = HW_ISOLATION_OBJPATH
     "/events/hw_isolation_status";
 
+/**
+ * @brief The inventory item interface to watch the runtime deallocation
+ */
+constexpr auto CpuCoreIface = "xyz.openbmc_project.Inventory.Item.CpuCore";
+
 constexpr auto HOST_STATE_OBJ_PATH = "/xyz/openbmc_project/state/host0";
 
 /*The different deconfig types that are allowed
@@ -54,14 +60,24 @@ std::vector<event::EventMsg> deconfigTypes = {
     "Fatal", "Predictive", "By Association", "Manual", "Spare core"};
 
 Manager::Manager(sdbusplus::bus::bus& bus, const sdeventplus::Event& eventLoop,
-                 record::Manager& hwIsolationRecordMgr) :
-    _bus(bus), _eventLoop(eventLoop), _lastEventId(0), _isolatableHWs(bus),
+                 record::Manager& hwIsolationRecordMgr,
+                 persist::WriteBehind& writeBehind,
+                 journal::ChangeJournal& changeJournal) :
+    type::ServerObject<EventQueryInterface>(bus, HW_STATUS_EVENTS_PATH),
+    _bus(bus), _eventLoop(eventLoop), _changeJournal(changeJournal),
+    _eventStore(event_store::HW_ISOLATION_EVENT_STORE_PERSIST_PATH,
+                fs::path(HW_ISOLATION_EVENT_PERSIST_PATH).parent_path(),
+                HW_STATUS_EVENT_STORE_CAPACITY, writeBehind),
+    _eventStoreStatus(bus, HW_STATUS_EVENTS_PATH),
+    _eventSummary(bus, HW_ISOLATION_OBJPATH),
+    _isolatableHWs(bus),
     _hwIsolationRecordMgr(hwIsolationRecordMgr),
-    _requiredHwsPdbgClass({"ocmb", "fc"})
+    _requiredHwsPdbgClass({"ocmb", "fc"}),
+    _deallocatedHwTimer(
+        eventLoop, std::chrono::milliseconds(HW_DEALLOCATION_WINDOW_MS),
+        std::chrono::milliseconds(HW_DEALLOCATION_WINDOW_MS),
+        std::bind(std::mem_fn(&Manager::handleDeallocatedHws), this))
 {
-    fs::create_directories(
-        fs::path(HW_ISOLATION_EVENT_PERSIST_PATH).parent_path());
-
     // Adding the required D-Bus match rules to create hardware status event
     // if interested signal is occurred.
     try
@@ -96,6 +112,44 @@ Manager::Manager(sdbusplus::bus::bus& bus, const sdeventplus::Event& eventLoop,
                                   error_log::Level::Informational,
                                   error_log::CollectTraces);
     }
+
+    _hwIsolationRecordMgr.subscribe(std::bind(
+        std::mem_fn(&Manager::onEntryChange), this, std::placeholders::_1));
+}
+
+/**
+ * @brief Helper function to get the hardware status event associations
+ *
+ * @param[in] hwInventoryPath - the hardware inventory path.
+ * @param[in] bmcErrorLogPath - the bmc error log object path.
+ *
+ * @return The hardware status event associations
+ */
+static type::AssociationDef
+    getEventAssociations(const std::string& hwInventoryPath,
+                         const std::string& bmcErrorLogPath)
+{
+    // Add association for the hareware inventory path which needs
+    // the hardware status event.
+    // Note: Association forward and reverse type are defined as per
+    // xyz::openbmc_project::Logging::Event interface associations
+    // documentation.
+    type::AsscDefFwdType eventIndicatorFwdType{"event_indicator"};
+    type::AsscDefRevType eventIndicatorRevType{"event_log"};
+    type::AssociationDef associationDeftoEvent;
+    associationDeftoEvent.push_back(std::make_tuple(
+        eventIndicatorFwdType, eventIndicatorRevType, hwInventoryPath));
+
+    // Add the error_log if given
+    if (!bmcErrorLogPath.empty())
+    {
+        type::AsscDefFwdType errorLogFwdType{"error_log"};
+        type::AsscDefFwdType errorLogRevType{"event_log"};
+        associationDeftoEvent.push_back(std::make_tuple(
+            errorLogFwdType, errorLogRevType, bmcErrorLogPath));
+    }
+
+    return associationDeftoEvent;
 }
 
 std::optional<sdbusplus::message::object_path> Manager::createEvent(
@@ -104,37 +158,32 @@ std::optional<sdbusplus::message::object_path> Manager::createEvent(
 {
     try
     {
-        auto id = _lastEventId + 1;
+        auto id = _eventStore.allocateEventId();
         auto eventObjPath = fs::path(HW_STATUS_EVENTS_PATH) /
                             std::to_string(id);
 
-        // Add association for the hareware inventory path which needs
-        // the hardware status event.
-        // Note: Association forward and reverse type are defined as per
-        // xyz::openbmc_project::Logging::Event interface associations
-        // documentation.
-        type::AsscDefFwdType eventIndicatorFwdType{"event_indicator"};
-        type::AsscDefRevType eventIndicatorRevType{"event_log"};
-        type::AssociationDef associationDeftoEvent;
-        associationDeftoEvent.push_back(std::make_tuple(
-            eventIndicatorFwdType, eventIndicatorRevType, hwInventoryPath));
-
-        // Add the error_log if given
-        if (!bmcErrorLogPath.empty())
+        auto eventIt = _hwStatusEvents.insert(std::make_pair(
+            id, std::make_unique<hw_isolation::event::Event>(
+                    _bus, eventObjPath, id, eventSeverity, eventMsg,
+                    getEventAssociations(hwInventoryPath, bmcErrorLogPath))));
+        _hwStatusEventsByInvPath.insert_or_assign(hwInventoryPath, id);
+        summarizeEvent(id, eventIt.first->second.get());
+        _changeJournal.add(journal::ChangeType::EventAdded,
+                           eventObjPath.string());
+
+        auto evictedEventId = _eventStore.put(
+            id, {eventSeverity, eventIt.first->second->timestamp(), eventMsg,
+                 hwInventoryPath, bmcErrorLogPath});
+        if (evictedEventId.has_value())
         {
-            type::AsscDefFwdType errorLogFwdType{"error_log"};
-            type::AsscDefFwdType errorLogRevType{"event_log"};
-            associationDeftoEvent.push_back(std::make_tuple(
-                errorLogFwdType, errorLogRevType, bmcErrorLogPath));
+            log<level::INFO>(
+                std::format("Removed the oldest hardware status event [{}] "
+                            "since the event store is full",
+                            *evictedEventId)
+                    .c_str());
+            removeEvent(*evictedEventId);
         }
 
-        _hwStatusEvents.insert(
-            std::make_pair(id, std::make_unique<hw_isolation::event::Event>(
-                                   _bus, eventObjPath, id, eventSeverity,
-                                   eventMsg, associationDeftoEvent)));
-
-        // Update the last event id using the created event id;
-        _lastEventId = id;
         return eventObjPath.string();
     }
     catch (const std::exception& e)
@@ -148,12 +197,328 @@ std::optional<sdbusplus::message::object_path> Manager::createEvent(
     return std::nullopt;
 }
 
-void Manager::clearHardwaresStatusEvent()
+void Manager::removeEvent(const EventId eventId)
+{
+    auto eventIt = _hwStatusEvents.find(eventId);
+    if (eventIt == _hwStatusEvents.end())
+    {
+        return;
+    }
+
+    auto indexIt =
+        _hwStatusEventsByInvPath.find(eventIt->second->getHwInventoryPath());
+    if ((indexIt != _hwStatusEventsByInvPath.end()) &&
+        (indexIt->second == eventId))
+    {
+        _hwStatusEventsByInvPath.erase(indexIt);
+    }
+
+    _eventStore.erase(eventId);
+    summarizeEvent(eventId, nullptr);
+    _hwStatusEvents.erase(eventIt);
+
+    _changeJournal.add(
+        journal::ChangeType::EventRemoved,
+        (fs::path(HW_STATUS_EVENTS_PATH) / std::to_string(eventId)).string());
+}
+
+void Manager::removeHwStatusEvent(const std::string& hwInventoryPath)
+{
+    auto indexIt = _hwStatusEventsByInvPath.find(hwInventoryPath);
+    if (indexIt != _hwStatusEventsByInvPath.end())
+    {
+        removeEvent(indexIt->second);
+    }
+}
+
+std::optional<sdbusplus::message::object_path>
+    Manager::getHwStatusEvent(const std::string& hwInventoryPath) const
+{
+    auto indexIt = _hwStatusEventsByInvPath.find(hwInventoryPath);
+    if (indexIt == _hwStatusEventsByInvPath.end())
+    {
+        return std::nullopt;
+    }
+    return (fs::path(HW_STATUS_EVENTS_PATH) / std::to_string(indexIt->second))
+        .string();
+}
+
+std::vector<EventQueryResult>
+    Manager::getEvents(std::vector<EventSeverity> severities,
+                       sdbusplus::message::object_path inventoryPath,
+                       uint64_t startTime, uint64_t endTime)
+{
+    if ((endTime != 0) && (startTime > endTime))
+    {
+        log<level::ERR>(std::format("Invalid argument [StartTime: {}, "
+                                    "EndTime: {}]",
+                                    startTime, endTime)
+                            .c_str());
+        throw type::CommonError::InvalidArgument();
+    }
+
+    // Use the inventory path index to get the candidates instead of
+    // walking all the events if the hardware is given.
+    std::vector<EventId> eventIds;
+    if (inventoryPath.str == "/")
+    {
+        eventIds.reserve(_hwStatusEvents.size());
+        for (const auto& [eventId, event] : _hwStatusEvents)
+        {
+            eventIds.emplace_back(eventId);
+        }
+    }
+    else
+    {
+        const auto childPathPrefix = inventoryPath.str + "/";
+        for (const auto& [hwInventoryPath, eventId] : _hwStatusEventsByInvPath)
+        {
+            if ((hwInventoryPath == inventoryPath.str) ||
+                hwInventoryPath.starts_with(childPathPrefix))
+            {
+                eventIds.emplace_back(eventId);
+            }
+        }
+        std::ranges::sort(eventIds);
+    }
+
+    std::vector<EventQueryResult> events;
+    for (const auto& eventId : eventIds)
+    {
+        const auto& event = *_hwStatusEvents.at(eventId);
+
+        if ((!severities.empty() &&
+             (std::ranges::find(severities, event.severity()) ==
+              severities.end())) ||
+            (event.timestamp() < startTime) ||
+            ((endTime != 0) && (event.timestamp() > endTime)))
+        {
+            continue;
+        }
+
+        auto bmcErrorLogPath = event.getBmcErrorLogPath();
+        events.emplace_back(
+            (fs::path(HW_STATUS_EVENTS_PATH) / std::to_string(eventId))
+                .string(),
+            event.severity(), event.timestamp(), event.message(),
+            event.getHwInventoryPath(),
+            bmcErrorLogPath.empty() ? "/" : bmcErrorLogPath);
+    }
+    return events;
+}
+
+void Manager::updateHwStatusEvent(
+    const std::string& hwInventoryPath,
+    const std::optional<DesiredEvent>& desiredEvent)
+{
+    // Keep the update to apply at the end of the in progress refresh (if any)
+    // so that, the refresh won't revert it.
+    if (_refreshCtx)
+    {
+        _refreshCtx->_updatedEvents.insert_or_assign(hwInventoryPath,
+                                                     desiredEvent);
+    }
+
+    if (!desiredEvent.has_value())
+    {
+        removeHwStatusEvent(hwInventoryPath);
+        return;
+    }
+
+    const auto& [eventSeverity, eventMsg, bmcErrorLogPath] = *desiredEvent;
+    auto indexIt = _hwStatusEventsByInvPath.find(hwInventoryPath);
+    if (indexIt == _hwStatusEventsByInvPath.end())
+    {
+        if (!createEvent(eventSeverity, eventMsg, hwInventoryPath,
+                         bmcErrorLogPath)
+                 .has_value())
+        {
+            log<level::ERR>(
+                std::format("Failed to create the event for the changed "
+                            "isolated hardware [{}]",
+                            hwInventoryPath)
+                    .c_str());
+            error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
+                                      error_log::Level::Informational,
+                                      error_log::CollectTraces);
+        }
+        return;
+    }
+
+    auto& event = _hwStatusEvents.at(indexIt->second);
+    if (event->update(eventSeverity, eventMsg,
+                      getEventAssociations(hwInventoryPath, bmcErrorLogPath)))
+    {
+        _eventStore.put(indexIt->second,
+                        {eventSeverity, event->timestamp(), eventMsg,
+                         hwInventoryPath, bmcErrorLogPath});
+        summarizeEvent(indexIt->second, event.get());
+        _changeJournal.add(journal::ChangeType::EventUpdated,
+                           (fs::path(HW_STATUS_EVENTS_PATH) /
+                            std::to_string(indexIt->second))
+                               .string());
+    }
+}
+
+void Manager::onEntryChange(const record::EntryChange& change)
+{
+    // The change is handled from the event loop to avoid the hardware
+    // lookups while the record manager is serving the request.
+    _changedIsolatedHws.insert_or_assign(change._isolatedHwInvPath,
+                                         change._entityPath);
+
+    if (!_entryChangeSource)
+    {
+        _entryChangeSource = std::make_unique<sdeventplus::source::Defer>(
+            _eventLoop, [this](sdeventplus::source::EventBase&) {
+            this->handleEntryChanges();
+        });
+        // Let the requests and signals go first
+        _entryChangeSource->set_priority(SD_EVENT_PRIORITY_IDLE);
+    }
+    else
+    {
+        _entryChangeSource->set_enabled(sdeventplus::source::Enabled::On);
+    }
+}
+
+void Manager::handleEntryChanges()
 {
-    // Remove all the existing hardware status event and
-    // reset the last event id as "0"
-    _hwStatusEvents.clear();
-    _lastEventId = 0;
+    // The source can't be released from its own callback so,
+    // just disable it.
+    _entryChangeSource->set_enabled(sdeventplus::source::Enabled::Off);
+
+    auto changedIsolatedHws = std::move(_changedIsolatedHws);
+    _changedIsolatedHws.clear();
+
+    auto osRunning = isOSRunning();
+    for (const auto& [isolatedHwInvPath, entityPath] : changedIsolatedHws)
+    {
+        auto isolatedHwTgt = devtree::getPhalDevTreeTgt(
+            devtree::convertEntityPathIntoRawData(entityPath));
+        if (!isolatedHwTgt.has_value())
+        {
+            log<level::ERR>(
+                std::format("Skipping to update the event for the changed "
+                            "isolated hardware [{}] since failed to get "
+                            "the device tree target",
+                            isolatedHwInvPath)
+                    .c_str());
+            continue;
+        }
+
+        // The events are created for the required hardware so, look for
+        // the required hardware which contains the isolated hardware
+        // (for example, the fused core of the core).
+        for (const auto& pdbgClass : _requiredHwsPdbgClass)
+        {
+            struct pdbg_target* tgt = *isolatedHwTgt;
+            if (pdbgClass != pdbg_target_class_name(tgt))
+            {
+                tgt = pdbg_target_parent(pdbgClass.c_str(), tgt);
+            }
+
+            if (tgt == nullptr)
+            {
+                continue;
+            }
+
+            DesiredEvents desiredEvents;
+            addDesiredEvent(pdbgClass, tgt, osRunning, desiredEvents);
+
+            for (const auto& [hwInventoryPath, desiredEvent] : desiredEvents)
+            {
+                updateHwStatusEvent(hwInventoryPath, desiredEvent);
+            }
+
+            // Remove the events which are not required anymore by using
+            // the same inventory path which the events are created with.
+            for (const auto& hwInventoryPath :
+                 getEventHwInventoryPaths(pdbgClass, tgt))
+            {
+                if (!desiredEvents.contains(hwInventoryPath))
+                {
+                    updateHwStatusEvent(hwInventoryPath, std::nullopt);
+                }
+            }
+            break;
+        }
+    }
+
+    updateEventStoreStatus();
+    updateEventSummary();
+}
+
+void Manager::reconcileEvents(DesiredEvents desiredEvents)
+{
+    size_t numOfRemoved{0};
+    size_t numOfUpdated{0};
+    for (auto eventIt = _hwStatusEvents.begin();
+         eventIt != _hwStatusEvents.end();)
+    {
+        auto hwInventoryPath = eventIt->second->getHwInventoryPath();
+
+        // The duplicate events of the same hardware are removed since,
+        // the desired event is consumed by the first event.
+        auto desiredIt = desiredEvents.find(hwInventoryPath);
+        if (desiredIt == desiredEvents.end())
+        {
+            auto eventId = eventIt->first;
+            ++eventIt;
+            removeEvent(eventId);
+            ++numOfRemoved;
+            continue;
+        }
+        _hwStatusEventsByInvPath.insert_or_assign(hwInventoryPath,
+                                                  eventIt->first);
+
+        const auto& [eventSeverity, eventMsg, bmcErrorLogPath] =
+            desiredIt->second;
+        if (eventIt->second->update(
+                eventSeverity, eventMsg,
+                getEventAssociations(hwInventoryPath, bmcErrorLogPath)))
+        {
+            _eventStore.put(eventIt->first,
+                            {eventSeverity, eventIt->second->timestamp(),
+                             eventMsg, hwInventoryPath, bmcErrorLogPath});
+            summarizeEvent(eventIt->first, eventIt->second.get());
+            _changeJournal.add(journal::ChangeType::EventUpdated,
+                               (fs::path(HW_STATUS_EVENTS_PATH) /
+                                std::to_string(eventIt->first))
+                                   .string());
+            ++numOfUpdated;
+        }
+        desiredEvents.erase(desiredIt);
+        ++eventIt;
+    }
+
+    for (const auto& [hwInventoryPath, desiredEvent] : desiredEvents)
+    {
+        auto eventObjPath =
+            createEvent(desiredEvent._severity, desiredEvent._message,
+                        hwInventoryPath, desiredEvent._bmcErrorLogPath);
+        if (!eventObjPath.has_value())
+        {
+            log<level::ERR>(
+                std::format("Skipping to create the hardware status event "
+                            "because unable to create the event object for "
+                            "the given hardware [{}]",
+                            hwInventoryPath)
+                    .c_str());
+            error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
+                                      error_log::Level::Informational,
+                                      error_log::CollectTraces);
+        }
+    }
+
+    log<level::INFO>(
+        std::format("Reconciled the hardware status events, added [{}] "
+                    "removed [{}] updated [{}]",
+                    desiredEvents.size(), numOfRemoved, numOfUpdated)
+            .c_str());
+
+    updateEventStoreStatus();
+    updateEventSummary();
 }
 
 std::pair<event::EventMsg, event::EventSeverity>
@@ -382,156 +747,253 @@ bool Manager::populateDetailsToCreateEvent(
 
 void Manager::restoreHardwaresStatusEvent(bool osRunning)
 {
-    clearHardwaresStatusEvent();
+    // Restart the in progress refresh (if any) since, the hardware state
+    // is changed.
+    _refreshCtx = std::make_unique<RefreshContext>();
+    _refreshCtx->_osRunning = osRunning;
 
-    std::for_each(_requiredHwsPdbgClass.begin(), _requiredHwsPdbgClass.end(),
-                  [this, osRunning](const auto& ele) {
+    for (const auto& pdbgClass : _requiredHwsPdbgClass)
+    {
         struct pdbg_target* tgt;
-        pdbg_for_each_class_target(ele.c_str(), tgt)
+        pdbg_for_each_class_target(pdbgClass.c_str(), tgt)
         {
-            try
-            {
-                if (ele == "fc")
-                {
-                    struct pdbg_target* coreTgt;
-                    bool ecoCore{false};
-                    pdbg_for_each_target("core", tgt, coreTgt)
-                    {
-                        if (devtree::isECOcore(coreTgt))
-                        {
-                            ecoCore = true;
-                            break;
-                        }
-                    }
-                    if (ecoCore)
-                    {
-                        // ECO core is not modelled in the inventory so,
-                        // event is not required to display the state of
-                        // the core.
-                        continue;
-                    }
-                }
-                else if (ele == "ocmb")
-                {
-                    // Look for all the logical Dimms under it and
-                    // process them together
-                    struct pdbg_target* dimmTgt;
-                    struct pdbg_target* mpTgt;
-
-                    std::vector<event::EventMsg> eventMsgList;
-                    std::vector<event::EventSeverity> eventSeverityList;
-                    std::vector<record::entry::EntryErrLogPath>
-                        eventErrLogPathList;
-                    // hwInventoryPath - should be the same for both that
-                    // children under that ocmb.
-                    std::optional<sdbusplus::message::object_path>
-                        hwInventoryPath;
-
-                    // dimm0=functional, dimm2=functional : functional (normal
-                    // dualport) dimm0=functional, dimm2=deconfigured : ILLEGAL,
-                    // deconfigured dimm0=functional, dimm2=nonpresent :
-                    // functional (normal singleport) dimm0=deconfigured ,
-                    // dimm2=functional : ILLEGAL, deconfigured
-                    pdbg_for_each_target("mem_port", tgt, mpTgt)
-                    {
-                        pdbg_for_each_target("dimm", mpTgt, dimmTgt)
-                        {
-                            bool createEvent = false;
-                            event::EventMsg eventMsg;
-                            event::EventSeverity eventSeverity;
-                            record::entry::EntryErrLogPath eventErrLogPath;
-                            createEvent = populateDetailsToCreateEvent(
-                                dimmTgt, osRunning, eventMsg, eventSeverity,
-                                eventErrLogPath, hwInventoryPath);
-                            // If we need to create an event wait and capture
-                            // all the events for that physical dimm and then
-                            // prioritize
-                            if (createEvent)
-                            {
-                                eventMsgList.push_back(eventMsg);
-                                eventSeverityList.push_back(eventSeverity);
-                                eventErrLogPathList.push_back(eventErrLogPath);
-                            }
-                        }
-                    }
+            _refreshCtx->_targets.emplace_back(pdbgClass, tgt);
+        }
+    }
 
-                    // We have as many number of deconfigurations as there are
-                    // DIMMs
-                    if (eventMsgList.size() > 0)
-                    {
-                        if (!hwInventoryPath.has_value())
-                        {
-                            // already logged error. Continue
-                            continue;
-                        }
-                        auto errSeverityStr =
-                            sdbusplus::xyz::openbmc_project::Logging::server::
-                                convertForMessage(eventSeverityList[0]);
+    if (!_refreshSource)
+    {
+        _refreshSource = std::make_unique<sdeventplus::source::Defer>(
+            _eventLoop, [this](sdeventplus::source::EventBase&) {
+            this->refreshHardwaresStatusEvent();
+        });
+        // Let the requests and signals go first
+        _refreshSource->set_priority(SD_EVENT_PRIORITY_IDLE);
+    }
+    else
+    {
+        _refreshSource->set_enabled(sdeventplus::source::Enabled::On);
+    }
+}
+
+void Manager::refreshHardwaresStatusEvent()
+{
+    auto sliceStartTime = std::chrono::steady_clock::now();
+    auto& targets = _refreshCtx->_targets;
+    while (_refreshCtx->_nextTarget < targets.size())
+    {
+        const auto& [pdbgClass, tgt] = targets[_refreshCtx->_nextTarget++];
+        addDesiredEvent(pdbgClass, tgt, _refreshCtx->_osRunning,
+                        _refreshCtx->_desiredEvents);
 
-                        // See which isolation record has higher priority and
-                        // use it.
-                        int index = getHigherPrecendenceEvent(eventMsgList);
+        if ((std::chrono::steady_clock::now() - sliceStartTime) >=
+            std::chrono::microseconds(RECONCILE_SLICE_BUDGET_US))
+        {
+            break;
+        }
+    }
 
-                        auto eventObjPath = createEvent(
-                            eventSeverityList[index], eventMsgList[index],
-                            hwInventoryPath->str, eventErrLogPathList[index]);
+    if (_refreshCtx->_nextTarget < targets.size())
+    {
+        // Continue from the next event loop iteration
+        return;
+    }
 
-                        if (!eventObjPath.has_value())
-                        {
-                            log<level::ERR>(
-                                std::format(
-                                    "Skipping to create the hardware "
-                                    "status event because unable to create "
-                                    "the event object for the given hardware "
-                                    "[{}]",
-                                    hwInventoryPath->str)
-                                    .c_str());
-                            error_log::createErrorLog(
-                                error_log::HwIsolationGenericErrMsg,
-                                error_log::Level::Informational,
-                                error_log::CollectTraces);
-                        }
-                    }
-                    continue;
-                }
-                event::EventMsg eventMsg;
-                event::EventSeverity eventSeverity;
-                record::entry::EntryErrLogPath eventErrLogPath;
-                std::optional<sdbusplus::message::object_path> hwInventoryPath;
-                bool create = false;
+    auto desiredEvents = std::move(_refreshCtx->_desiredEvents);
+    for (const auto& [hwInventoryPath, desiredEvent] :
+         _refreshCtx->_updatedEvents)
+    {
+        if (desiredEvent.has_value())
+        {
+            desiredEvents.insert_or_assign(hwInventoryPath, *desiredEvent);
+        }
+        else
+        {
+            desiredEvents.erase(hwInventoryPath);
+        }
+    }
+    _refreshCtx.reset();
 
-                create = populateDetailsToCreateEvent(
-                    tgt, osRunning, eventMsg, eventSeverity, eventErrLogPath,
-                    hwInventoryPath);
+    // The source can't be released from its own callback so,
+    // just disable it.
+    _refreshSource->set_enabled(sdeventplus::source::Enabled::Off);
 
-                if (create)
+    reconcileEvents(std::move(desiredEvents));
+}
+
+void Manager::addDesiredEvent(const std::string& pdbgClass,
+                              struct pdbg_target* tgt, bool osRunning,
+                              DesiredEvents& desiredEvents)
+{
+    try
+    {
+        if (pdbgClass == "fc")
+        {
+            struct pdbg_target* coreTgt;
+            bool ecoCore{false};
+            pdbg_for_each_target("core", tgt, coreTgt)
+            {
+                if (devtree::isECOcore(coreTgt))
                 {
-                    if (!hwInventoryPath.has_value())
+                    ecoCore = true;
+                    break;
+                }
+            }
+            if (ecoCore)
+            {
+                // ECO core is not modelled in the inventory so,
+                // event is not required to display the state of
+                // the core.
+                return;
+            }
+        }
+        else if (pdbgClass == "ocmb")
+        {
+            // Look for all the logical Dimms under it and
+            // process them together
+            struct pdbg_target* dimmTgt;
+            struct pdbg_target* mpTgt;
+
+            std::vector<event::EventMsg> eventMsgList;
+            std::vector<event::EventSeverity> eventSeverityList;
+            std::vector<record::entry::EntryErrLogPath> eventErrLogPathList;
+            // hwInventoryPath - should be the same for both that
+            // children under that ocmb.
+            std::optional<sdbusplus::message::object_path> hwInventoryPath;
+
+            // dimm0=functional, dimm2=functional : functional (normal
+            // dualport) dimm0=functional, dimm2=deconfigured : ILLEGAL,
+            // deconfigured dimm0=functional, dimm2=nonpresent :
+            // functional (normal singleport) dimm0=deconfigured ,
+            // dimm2=functional : ILLEGAL, deconfigured
+            pdbg_for_each_target("mem_port", tgt, mpTgt)
+            {
+                pdbg_for_each_target("dimm", mpTgt, dimmTgt)
+                {
+                    bool createEvent = false;
+                    event::EventMsg eventMsg;
+                    event::EventSeverity eventSeverity;
+                    record::entry::EntryErrLogPath eventErrLogPath;
+                    createEvent = populateDetailsToCreateEvent(
+                        dimmTgt, osRunning, eventMsg, eventSeverity,
+                        eventErrLogPath, hwInventoryPath);
+                    // If we need to create an event wait and capture
+                    // all the events for that physical dimm and then
+                    // prioritize
+                    if (createEvent)
                     {
-                        // already logged error. Continue
-                        continue;
+                        eventMsgList.push_back(eventMsg);
+                        eventSeverityList.push_back(eventSeverity);
+                        eventErrLogPathList.push_back(eventErrLogPath);
                     }
+                }
+            }
 
-                    auto eventObjPath = createEvent(eventSeverity, eventMsg,
-                                                    hwInventoryPath->str,
-                                                    eventErrLogPath);
+            // We have as many number of deconfigurations as there are
+            // DIMMs
+            if (eventMsgList.size() > 0)
+            {
+                if (!hwInventoryPath.has_value())
+                {
+                    // already logged error. Continue
+                    return;
                 }
+                auto errSeverityStr =
+                    sdbusplus::xyz::openbmc_project::Logging::server::
+                        convertForMessage(eventSeverityList[0]);
+
+                // See which isolation record has higher priority and
+                // use it.
+                int index = getHigherPrecendenceEvent(eventMsgList);
+
+                desiredEvents.insert_or_assign(
+                    hwInventoryPath->str,
+                    DesiredEvent{eventSeverityList[index], eventMsgList[index],
+                                 eventErrLogPathList[index]});
             }
-            catch (const std::exception& e)
+            return;
+        }
+        event::EventMsg eventMsg;
+        event::EventSeverity eventSeverity;
+        record::entry::EntryErrLogPath eventErrLogPath;
+        std::optional<sdbusplus::message::object_path> hwInventoryPath;
+        bool create = false;
+
+        create = populateDetailsToCreateEvent(tgt, osRunning, eventMsg,
+                                              eventSeverity, eventErrLogPath,
+                                              hwInventoryPath);
+
+        if (create)
+        {
+            if (!hwInventoryPath.has_value())
             {
-                log<level::ERR>(
-                    std::format("Exception [{}], skipping to create "
-                                "the hardware status event for the given "
-                                "hardware [{}]",
-                                e.what(), pdbg_target_path(tgt))
-                        .c_str());
-                error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
-                                          error_log::Level::Informational,
-                                          error_log::CollectTraces);
-                continue;
+                // already logged error. Continue
+                return;
             }
+
+            desiredEvents.insert_or_assign(
+                hwInventoryPath->str,
+                DesiredEvent{eventSeverity, eventMsg, eventErrLogPath});
         }
-    });
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(
+            std::format("Exception [{}], skipping to create "
+                        "the hardware status event for the given "
+                        "hardware [{}]",
+                        e.what(), pdbg_target_path(tgt))
+                .c_str());
+        error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
+                                  error_log::Level::Informational,
+                                  error_log::CollectTraces);
+    }
+}
+
+std::set<std::string>
+    Manager::getEventHwInventoryPaths(const std::string& pdbgClass,
+                                      struct pdbg_target* tgt)
+{
+    std::vector<struct pdbg_target*> eventTgts;
+    if (pdbgClass == "ocmb")
+    {
+        struct pdbg_target* dimmTgt;
+        struct pdbg_target* mpTgt;
+        pdbg_for_each_target("mem_port", tgt, mpTgt)
+        {
+            pdbg_for_each_target("dimm", mpTgt, dimmTgt)
+            {
+                eventTgts.emplace_back(dimmTgt);
+            }
+        }
+    }
+    else
+    {
+        eventTgts.emplace_back(tgt);
+    }
+
+    std::set<std::string> hwInventoryPaths;
+    for (const auto& eventTgt : eventTgts)
+    {
+        try
+        {
+            bool ecoCore{false};
+            auto hwInventoryPath = _isolatableHWs.getInventoryPath(
+                devtree::getPhysicalPath(eventTgt), ecoCore);
+            if (hwInventoryPath.has_value())
+            {
+                hwInventoryPaths.emplace(hwInventoryPath->str);
+            }
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(std::format("Exception [{}] to get the inventory "
+                                        "path of the hardware [{}]",
+                                        e.what(), pdbg_target_path(eventTgt))
+                                .c_str());
+        }
+    }
+    return hwInventoryPaths;
 }
 
 int Manager::getHigherPrecendenceEvent(
@@ -564,73 +1026,60 @@ int Manager::getHigherPrecendenceEvent(
     return 0;
 }
 
-void Manager::clearHwStatusEventIfexists(const std::string& hwInventoryPath)
+void Manager::handleDeallocatedHws()
 {
-    std::erase_if(_hwStatusEvents, [this, hwInventoryPath](const auto& ele) {
-        for (const auto& assocEle : ele.second->associations())
+    auto deallocatedHws = std::move(_pendingDeallocatedHws);
+    _pendingDeallocatedHws.clear();
+
+    DesiredEvents deallocatedHwEvents;
+    for (const auto& deallocatedHw : deallocatedHws)
+    {
+        auto isolatedhwRecordInfo =
+            _hwIsolationRecordMgr.getIsolatedHwRecordInfo(deallocatedHw);
+
+        if (!isolatedhwRecordInfo.has_value())
         {
-            if ((std::get<0>(assocEle) == "event_indicator") &&
-                (std::get<2>(assocEle) == hwInventoryPath))
-            {
-                return true;
-            }
+            // No action, just deconfigured without
+            // hardware isolation record
+            continue;
         }
 
-        return false;
-    });
-}
+        log<level::INFO>(
+            std::format("{} is deallocated at the host runtime", deallocatedHw)
+                .c_str());
 
-void Manager::handleDeallocatedHw()
-{
-    auto deallocatedHw = std::move(_deallocatedHwHandler.front());
-    _deallocatedHwHandler.pop();
-    if (deallocatedHw.second->isEnabled())
-    {
-        deallocatedHw.second->setEnabled(false);
-    }
+        auto hwStatusInfo =
+            getIsolatedHwStatusInfo(std::get<0>(*isolatedhwRecordInfo));
 
-    auto isolatedhwRecordInfo = _hwIsolationRecordMgr.getIsolatedHwRecordInfo(
-        std::string(deallocatedHw.first));
+        deallocatedHwEvents.emplace(
+            deallocatedHw,
+            DesiredEvent{std::get<1>(hwStatusInfo), std::get<0>(hwStatusInfo),
+                         std::get<1>(*isolatedhwRecordInfo)});
+    }
 
-    if (!isolatedhwRecordInfo.has_value())
+    if (deallocatedHwEvents.empty())
     {
-        // No action, just deconfigured without
-        // hardware isolation record
         return;
     }
 
-    log<level::INFO>(std::format("{} is deallocated at the host runtime",
-                                 deallocatedHw.first)
-                         .c_str());
-
-    record::entry::EntryErrLogPath eventErrLogPath =
-        std::get<1>(*isolatedhwRecordInfo);
-
-    auto hwStatusInfo =
-        getIsolatedHwStatusInfo(std::get<0>(*isolatedhwRecordInfo));
-
-    event::EventMsg eventMsg = std::get<0>(hwStatusInfo);
-    event::EventSeverity eventSeverity = std::get<1>(hwStatusInfo);
-
-    clearHwStatusEventIfexists(deallocatedHw.first);
-
-    auto eventObjPath = createEvent(eventSeverity, eventMsg,
-                                    deallocatedHw.first, eventErrLogPath);
-    if (!eventObjPath.has_value())
+    // Update the existing event (if any) in place to keep the event id
+    // and, to leave the unchanged event as is.
+    for (const auto& [deallocatedHw, event] : deallocatedHwEvents)
     {
-        log<level::ERR>(std::format("Failed to create the event for {} "
-                                    "that was deallocated at the host "
-                                    "runtime",
-                                    deallocatedHw.first)
-                            .c_str());
-        error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
-                                  error_log::Level::Informational,
-                                  error_log::CollectTraces);
+        updateHwStatusEvent(deallocatedHw, event);
     }
+
+    updateEventStoreStatus();
+    updateEventSummary();
 }
 
 void Manager::onOperationalStatusChange(sdbusplus::message::message& message)
 {
+    if (!_operationalStatusWatchedObjs.contains(message.get_path()))
+    {
+        return;
+    }
+
     try
     {
         dbus_type::Interface interface;
@@ -646,16 +1095,10 @@ void Manager::onOperationalStatusChange(sdbusplus::message::message& message)
                 {
                     if (!(*propVal))
                     {
-                        _deallocatedHwHandler.emplace(std::make_pair(
-                            message.get_path(),
-                            std::make_unique<sdeventplus::utility::Timer<
-                                sdeventplus::ClockId::Monotonic>>(
-                                _eventLoop,
-                                std::bind(std::mem_fn(
-                                              &hw_isolation::event::hw_status::
-                                                  Manager::handleDeallocatedHw),
-                                          this),
-                                std::chrono::seconds(5))));
+                        // The repeated signals of the same hardware are
+                        // handled once in the batch.
+                        _pendingDeallocatedHws.emplace(message.get_path());
+                        _deallocatedHwTimer.trigger();
                     }
                 }
                 else
@@ -692,54 +1135,131 @@ void Manager::onOperationalStatusChange(sdbusplus::message::message& message)
     }
 }
 
-void Manager::watchOperationalStatusChange()
+void Manager::onWatchedObjAdded(sdbusplus::message::message& message)
 {
-    constexpr auto CpuCoreIface = "xyz.openbmc_project.Inventory.Item.CpuCore";
-    auto objsToWatch = utils::getChildsInventoryPath(
-        _bus, std::string("/xyz/openbmc_project/inventory"), CpuCoreIface);
+    try
+    {
+        sdbusplus::message::object_path objPath;
+        type::InventoryInterfaces interfaces;
 
-    if (!objsToWatch.has_value())
+        message.read(objPath, interfaces);
+
+        if (interfaces.contains(CpuCoreIface))
+        {
+            _operationalStatusWatchedObjs.emplace(objPath.str);
+        }
+    }
+    catch (const sdbusplus::exception::exception& e)
     {
         log<level::ERR>(
-            std::format("Failed to get the {} objects from the inventory "
-                        "to watch Functional property",
-                        CpuCoreIface)
+            std::format("Exception [{}] and D-Bus Message signature [{}] "
+                        "so failed to read the InterfacesAdded signal to "
+                        "watch OperationalStatus",
+                        e.what(), message.get_signature())
                 .c_str());
-        return;
     }
+}
 
-    // Clear old watcher since inventory item objects might be
-    // vary if the respective FRU is replaced.
-    _watcherOnOperationalStatus.clear();
+void Manager::onWatchedObjRemoved(sdbusplus::message::message& message)
+{
+    try
+    {
+        sdbusplus::message::object_path objPath;
+        std::vector<std::string> interfaces;
 
-    for (const auto& objToWatch : *objsToWatch)
+        message.read(objPath, interfaces);
+
+        if (std::ranges::find(interfaces, CpuCoreIface) != interfaces.end())
+        {
+            _operationalStatusWatchedObjs.erase(objPath.str);
+        }
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        log<level::ERR>(
+            std::format("Exception [{}] and D-Bus Message signature [{}] "
+                        "so failed to read the InterfacesRemoved signal to "
+                        "watch OperationalStatus",
+                        e.what(), message.get_signature())
+                .c_str());
+    }
+}
+
+void Manager::watchOperationalStatusChange()
+{
+    constexpr auto InventoryPath = "/xyz/openbmc_project/inventory";
+
+    // Add the match rules once and, keep the watched objects list up to date
+    // by the inventory item interface addition and removal instead of
+    // adding the match rule per object.
+    if (_watcherOnOperationalStatus.empty())
     {
         try
         {
             namespace sdbusplus_match = sdbusplus::bus::match;
-            _watcherOnOperationalStatus.insert(std::make_pair(
-                objToWatch.str,
+            _watcherOnOperationalStatus.emplace_back(
                 std::make_unique<sdbusplus_match::match>(
                     _bus,
-                    sdbusplus_match::rules::propertiesChanged(
-                        objToWatch.str, "xyz.openbmc_project.State.Decorator."
-                                        "OperationalStatus"),
+                    sdbusplus_match::rules::type::signal() +
+                        sdbusplus_match::rules::member("PropertiesChanged") +
+                        sdbusplus_match::rules::interface(
+                            "org.freedesktop.DBus.Properties") +
+                        sdbusplus_match::rules::path_namespace(InventoryPath) +
+                        sdbusplus_match::rules::argN(
+                            0, "xyz.openbmc_project.State.Decorator."
+                               "OperationalStatus"),
                     std::bind(std::mem_fn(&Manager::onOperationalStatusChange),
-                              this, std::placeholders::_1))));
+                              this, std::placeholders::_1)));
+
+            _watcherOnOperationalStatus.emplace_back(
+                std::make_unique<sdbusplus_match::match>(
+                    _bus,
+                    sdbusplus_match::rules::interfacesAdded(InventoryPath),
+                    std::bind(std::mem_fn(&Manager::onWatchedObjAdded), this,
+                              std::placeholders::_1)));
+
+            _watcherOnOperationalStatus.emplace_back(
+                std::make_unique<sdbusplus_match::match>(
+                    _bus,
+                    sdbusplus_match::rules::interfacesRemoved(InventoryPath),
+                    std::bind(std::mem_fn(&Manager::onWatchedObjRemoved), this,
+                              std::placeholders::_1)));
         }
         catch (const std::exception& e)
         {
-            // Just log error and continue with next object
             log<level::ERR>(
                 std::format("Exception [{}] while adding the D-Bus match "
-                            "rules for {} to watch OperationalStatus",
-                            e.what(), objToWatch.str)
+                            "rules to watch OperationalStatus",
+                            e.what())
                     .c_str());
             error_log::createErrorLog(error_log::HwIsolationGenericErrMsg,
                                       error_log::Level::Informational,
                                       error_log::CollectTraces);
+            _watcherOnOperationalStatus.clear();
+            return;
         }
     }
+
+    auto objsToWatch = utils::getChildsInventoryPath(
+        _bus, std::string(InventoryPath), CpuCoreIface);
+
+    if (!objsToWatch.has_value())
+    {
+        log<level::ERR>(
+            std::format("Failed to get the {} objects from the inventory "
+                        "to watch Functional property",
+                        CpuCoreIface)
+                .c_str());
+        return;
+    }
+
+    // Refresh the watched objects since inventory item objects might be
+    // vary if the respective FRU is replaced.
+    _operationalStatusWatchedObjs.clear();
+    for (const auto& objToWatch : *objsToWatch)
+    {
+        _operationalStatusWatchedObjs.emplace(objToWatch.str);
+    }
 }
 
 void Manager::onHostStateChange(sdbusplus::message::message& message)
@@ -779,6 +1299,7 @@ void Manager::onHostStateChange(sdbusplus::message::message& message)
                                             *propVal)
                                     .c_str());
                             _watcherOnOperationalStatus.clear();
+                            _operationalStatusWatchedObjs.clear();
                         }
                     }
                 }
@@ -902,33 +1423,83 @@ bool Manager::isOSRunning()
 
 void Manager::restorePersistedHwIsolationStatusEvent()
 {
-    auto createEventForPersistedEventFile = [this](const auto& file) {
-        auto fileEventId = std::stoul(file.path().filename());
-
+    for (const auto& [eventId, event] : _eventStore.getEvents())
+    {
         auto eventObjPath = fs::path(HW_STATUS_EVENTS_PATH) /
-                            file.path().filename();
+                            std::to_string(eventId);
 
-        // All members will be filled from persisted file.
-        this->_hwStatusEvents.insert(std::make_pair(
-            fileEventId,
+        auto eventIt = _hwStatusEvents.insert(std::make_pair(
+            eventId,
             std::make_unique<hw_isolation::event::Event>(
-                this->_bus, eventObjPath, fileEventId, event::EventSeverity(),
-                event::EventMsg(), type::AssociationDef(), true)));
+                _bus, eventObjPath, eventId, event._severity, event._message,
+                getEventAssociations(event._hwInventoryPath,
+                                     event._bmcErrorLogPath),
+                event._timestamp)));
+        _hwStatusEventsByInvPath.insert_or_assign(event._hwInventoryPath,
+                                                  eventId);
+        summarizeEvent(eventId, eventIt.first->second.get());
+    }
+
+    updateEventStoreStatus();
+    updateEventSummary();
+}
 
-        if (this->_lastEventId < fileEventId)
+void Manager::updateEventStoreStatus()
+{
+    _eventStoreStatus.capacity(
+        static_cast<uint32_t>(_eventStore.getCapacity()));
+    _eventStoreStatus.events(static_cast<uint32_t>(_hwStatusEvents.size()));
+    _eventStoreStatus.evictedEvents(
+        static_cast<uint32_t>(_eventStore.getNumOfEvictedEvents()));
+    _eventStoreStatus.memoryUsage(
+        _eventStore.getMemoryUsage() + _hwStatusEvents.size() * sizeof(Event));
+}
+
+void Manager::summarizeEvent(const EventId eventId, const Event* event)
+{
+    if (auto summarizedIt = _summarizedEvents.find(eventId);
+        summarizedIt != _summarizedEvents.end())
+    {
+        const auto& [severity, message] = summarizedIt->second;
+        if (auto countIt = _eventsBySeverity.find(severity);
+            (countIt != _eventsBySeverity.end()) && (--countIt->second == 0))
+        {
+            _eventsBySeverity.erase(countIt);
+        }
+        if (auto countIt = _eventsByMessage.find(message);
+            (countIt != _eventsByMessage.end()) && (--countIt->second == 0))
         {
-            this->_lastEventId = fileEventId;
+            _eventsByMessage.erase(countIt);
         }
-    };
+        _summarizedEvents.erase(summarizedIt);
+    }
 
-    std::ranges::for_each(
-        fs::directory_iterator(
-            fs::path(HW_ISOLATION_EVENT_PERSIST_PATH).parent_path()),
-        createEventForPersistedEventFile);
+    if (event != nullptr)
+    {
+        ++_eventsBySeverity[event->severity()];
+        ++_eventsByMessage[event->message()];
+        _summarizedEvents.emplace(
+            eventId, std::make_pair(event->severity(), event->message()));
+    }
 }
 
-void Manager::restore()
+void Manager::updateEventSummary()
 {
+    std::map<std::string, uint32_t> eventsBySeverity;
+    for (const auto& [severity, count] : _eventsBySeverity)
+    {
+        eventsBySeverity.emplace(
+            EventInterface::convertSeverityLevelToString(severity), count);
+    }
+
+    _eventSummary.eventsBySeverity(std::move(eventsBySeverity));
+    _eventSummary.eventsByMessage(_eventsByMessage);
+}
+
+void Manager::restore(restore_status::RestoreStatus& restoreStatus)
+{
+    restoreStatus.events(restore_status::Phase::InProgress);
+
     auto osRunning = isOSRunning();
 
     restorePersistedHwIsolationStatusEvent();
@@ -937,6 +1508,8 @@ void Manager::restore()
     {
         watchOperationalStatusChange();
     }
+
+    restoreStatus.events(restore_status::Phase::Completed);
 }
 
 } // namespace hw_status
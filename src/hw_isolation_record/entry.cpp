@@ -5,17 +5,10 @@
 #include "common/utils.hpp"
 #include "hw_isolation_record/manager.hpp"
 
-#include <cereal/archives/binary.hpp>
 #include <phosphor-logging/elog-errors.hpp>
 
 #include <ctime>
 #include <format>
-#include <fstream>
-
-// Associate Entry Class with version number
-constexpr uint32_t Cereal_EntryClassVersion = 1;
-CEREAL_CLASS_VERSION(hw_isolation::record::entry::Entry,
-                     Cereal_EntryClassVersion);
 
 namespace hw_isolation
 {
@@ -23,7 +16,6 @@ namespace record
 {
 namespace entry
 {
-namespace fs = std::filesystem;
 
 using namespace phosphor::logging;
 
@@ -33,14 +25,16 @@ Entry::Entry(sdbusplus::bus::bus& bus, const std::string& objPath,
              const EntrySeverity isolatedHwSeverity,
              const EntryResolved entryIsResolved,
              const type::AssociationDef& associationDef,
-             const openpower_guard::EntityPath& entityPath) :
+             const openpower_guard::EntityPath& entityPath,
+             const EntryErrLogId entryErrLogId, const bool deferEmit) :
     type::ServerObject<EntryInterface, AssociationDefInterface, EpochTime,
                        DeleteInterface>(
         bus, objPath.c_str(),
         type::ServerObject<EntryInterface, AssociationDefInterface, EpochTime,
                            DeleteInterface>::action::defer_emit),
     _bus(bus), _hwIsolationRecordMgr(hwIsolationRecordMgr),
-    _entryRecordId(entryRecordId), _entityPath(entityPath)
+    _entryRecordId(entryRecordId), _entityPath(entityPath),
+    _entryErrLogId(entryErrLogId)
 {
     // Setting properties which are defined in EntryInterface
     severity(isolatedHwSeverity);
@@ -53,26 +47,24 @@ Entry::Entry(sdbusplus::bus::bus& bus, const std::string& objPath,
 
     // Signal won't be sent since D-Bus name requested after restore
     // even if we sent noop at the mapper side.
-    if (!deserialize())
-    {
-        // Need to serialize entry members if it did not deserialize
-        // since this constructor might be called in the restore path
-        // and at the runtime
-        serialize();
-    }
+    deserialize();
+
+    // Need to serialize entry members even if it deserialized since,
+    // the resolved paths might be changed. Nothing will be written if
+    // the members are not changed.
+    serialize();
 
     // Emit the signal for entry object creation since it deferred in
     // interface constructor
-    this->emit_object_added();
+    if (!deferEmit)
+    {
+        this->emit_object_added();
+    }
 }
 
 Entry::~Entry()
 {
-    fs::path path{std::format(HW_ISOLATION_ENTRY_PERSIST_PATH, _entryRecordId)};
-    if (fs::exists(path))
-    {
-        fs::remove(path);
-    }
+    _hwIsolationRecordMgr.getEntryLog().erase(_entryRecordId);
 }
 
 void Entry::resolveEntry(bool clearRecord)
@@ -126,48 +118,90 @@ EntryRecordId Entry::getEntryRecId() const
     return _entryRecordId;
 }
 
-void Entry::serialize()
+EntryErrLogId Entry::getEntryErrLogId() const
 {
-    fs::path path{std::format(HW_ISOLATION_ENTRY_PERSIST_PATH, _entryRecordId)};
-    try
+    return _entryErrLogId;
+}
+
+void Entry::setEntryErrLogId(const EntryErrLogId entryErrLogId)
+{
+    _entryErrLogId = entryErrLogId;
+}
+
+bool Entry::isEcoCore() const
+{
+    return _ecoCore;
+}
+
+void Entry::setEcoCore(const bool ecoCore)
+{
+    if (_ecoCore != ecoCore)
     {
-        std::ofstream os(path.c_str(), std::ios::binary);
-        cereal::BinaryOutputArchive oarchive(os);
-        oarchive(*this);
+        _ecoCore = ecoCore;
+        serialize();
     }
-    catch (const cereal::Exception& e)
+}
+
+std::string Entry::getIsolatedHwInvPath() const
+{
+    for (const auto& [fwdType, revType, objPath] : associations())
     {
-        log<level::ERR>(std::format("Exception: [{}] during serialize the "
-                                    "hardware isolation entry into {}",
-                                    e.what(), path.string())
-                            .c_str());
-        fs::remove(path);
+        if (fwdType == "isolated_hw")
+        {
+            return objPath;
+        }
     }
+    return std::string();
 }
 
-bool Entry::deserialize()
+EntryErrLogPath Entry::getBmcErrorLogPath() const
 {
-    fs::path path{std::format(HW_ISOLATION_ENTRY_PERSIST_PATH, _entryRecordId)};
-    try
+    for (const auto& [fwdType, revType, objPath] : associations())
     {
-        if (fs::exists(path))
+        if (fwdType == "isolated_hw_errorlog")
         {
-            std::ifstream is(path.c_str(), std::ios::in | std::ios::binary);
-            cereal::BinaryInputArchive iarchive(is);
-            iarchive(*this);
-            return true;
+            return objPath;
         }
+    }
+    return EntryErrLogPath();
+}
+
+void Entry::serialize()
+{
+    // Keep the resolved paths to reuse in the restore path
+    entry_log::PersistedEntry persistedEntry{
+        hw_isolation::devtree::convertEntityPathIntoRawData(_entityPath),
+        elapsed(),
+        _ecoCore,
+        getIsolatedHwInvPath(),
+        _entryErrLogId,
+        getBmcErrorLogPath(),
+        _hwIsolationRecordMgr.getDevTreeGeneration()};
+
+    _hwIsolationRecordMgr.getEntryLog().put(_entryRecordId, persistedEntry);
+}
+
+bool Entry::deserialize()
+{
+    auto persistedEntry =
+        _hwIsolationRecordMgr.getEntryLog().get(_entryRecordId);
+    if (!persistedEntry.has_value())
+    {
         return false;
     }
-    catch (const cereal::Exception& e)
+
+    if (openpower_guard::EntityPath(persistedEntry->_entityPath.data(),
+                                    persistedEntry->_entityPath.size()) !=
+        _entityPath)
     {
-        log<level::ERR>(std::format("Exception: [{}] during deserialize the "
-                                    "hardware isolation entry from {}",
-                                    e.what(), path.string())
-                            .c_str());
-        fs::remove(path);
+        // The persisted entry is not belongs to the same hardware
         return false;
     }
+
+    // Skip to send property change signal in the restore path.
+    elapsed(persistedEntry->_elapsed, true);
+    _ecoCore = persistedEntry->_ecoCore;
+    return true;
 }
 
 namespace utils
@@ -0,0 +1,442 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hw_isolation_record/entry_log.hpp"
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <format>
+#include <sstream>
+
+namespace hw_isolation
+{
+namespace record
+{
+namespace entry_log
+{
+
+using namespace phosphor::logging;
+
+/**
+ * @brief The log header magic ("HWEL") and the log format version
+ *
+ * @note The version 1 record does not contain the ECO core flag and,
+ *       the version 2 record does not contain the resolved paths.
+ */
+constexpr uint32_t LogMagic = 0x4857454C;
+constexpr uint32_t LogVersion = 3;
+constexpr uint32_t LogVersionWithEcoCore = 2;
+constexpr uint32_t LogVersionWithoutEcoCore = 1;
+
+/**
+ * @brief The minimum number of log records to consider the compaction
+ */
+constexpr size_t CompactionThreshold = 64;
+
+/**
+ * @brief The maximum size of one log record payload, used to detect
+ *        the corrupted record length.
+ */
+constexpr uint32_t MaxRecordPayloadSize = 4096;
+
+/**
+ * @brief Helper function to get the FNV-1a hash of the log record payload
+ *
+ * @param[in] payload - the log record payload
+ *
+ * @return The payload checksum
+ */
+static uint32_t getChecksum(const std::string& payload)
+{
+    uint32_t hash = 2166136261U;
+    for (const auto& byte : payload)
+    {
+        hash ^= static_cast<uint8_t>(byte);
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+/**
+ * @brief Helper function to write the given value as raw bytes
+ */
+template <typename T>
+static void writeRaw(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * @brief Helper function to read the given value from raw bytes
+ *
+ * @return true on success, false if the stream is ended
+ */
+template <typename T>
+static bool readRaw(std::istream& is, T& value)
+{
+    is.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return is.gcount() == sizeof(value);
+}
+
+/**
+ * @brief Helper function to write the log header
+ */
+static void writeHeader(std::ostream& os)
+{
+    writeRaw(os, LogMagic);
+    writeRaw(os, LogVersion);
+}
+
+/**
+ * @brief Helper function to write one log record
+ */
+static void writeRecord(std::ostream& os, const uint8_t operation,
+                        const EntryRecordId entryRecordId,
+                        const PersistedEntry& entry)
+{
+    std::ostringstream payloadStream;
+    {
+        cereal::BinaryOutputArchive oarchive(payloadStream);
+        oarchive(operation, entryRecordId, entry._entityPath, entry._elapsed,
+                 entry._ecoCore, entry._inventoryPath, entry._errLogId,
+                 entry._bmcErrorLogPath, entry._generation);
+    }
+    auto payload = payloadStream.str();
+
+    writeRaw(os, static_cast<uint32_t>(payload.size()));
+    os.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    writeRaw(os, getChecksum(payload));
+}
+
+EntryLog::EntryLog(const fs::path& logPath, const fs::path& legacyDirPath,
+                   persist::WriteBehind& writeBehind) :
+    _logPath(logPath), _writeBehind(writeBehind),
+    _writerId(_writeBehind.addWriter(
+        std::bind(std::mem_fn(&EntryLog::write), this)))
+{
+    fs::create_directories(_logPath.parent_path());
+
+    bool compactRequired = !load();
+    auto importedFiles = importLegacyEntries(legacyDirPath);
+    compactRequired |= !importedFiles.empty();
+
+    if (compactRequired || !fs::exists(_logPath))
+    {
+        if (!compact())
+        {
+            // Keep the legacy files to import again
+            return;
+        }
+    }
+    else
+    {
+        _logStream.open(_logPath, std::ios::binary | std::ios::app);
+    }
+
+    // Remove the legacy files only once the imported entries are durable
+    // in the log, and keep the files which are failed to import.
+    std::error_code ec;
+    for (const auto& file : importedFiles)
+    {
+        fs::remove(file, ec);
+    }
+    if (fs::exists(legacyDirPath, ec) && fs::is_empty(legacyDirPath, ec))
+    {
+        fs::remove(legacyDirPath, ec);
+    }
+}
+
+bool EntryLog::load()
+{
+    if (!fs::exists(_logPath))
+    {
+        return true;
+    }
+
+    std::ifstream is(_logPath, std::ios::in | std::ios::binary);
+
+    uint32_t magic{0};
+    uint32_t version{0};
+    if (!readRaw(is, magic) || !readRaw(is, version) || (magic != LogMagic) ||
+        (version < LogVersionWithoutEcoCore) || (version > LogVersion))
+    {
+        log<level::ERR>(
+            std::format("Ignoring the hardware isolation entry log [{}] "
+                        "due to unsupported header, magic [{:#x}] "
+                        "version [{}]",
+                        _logPath.string(), magic, version)
+                .c_str());
+
+        // Keep the entries of the unsupported log (for example, written by
+        // the newer version) instead of overwriting them by the new log.
+        is.close();
+        persist::keepAside(_logPath);
+        return false;
+    }
+
+    // The records are appended one by one so, the log is corrupted
+    // if any record is not read completely.
+    bool corrupted{false};
+    while (is.peek() != std::char_traits<char>::eof())
+    {
+        uint32_t payloadSize{0};
+        if (!readRaw(is, payloadSize) ||
+            (payloadSize > MaxRecordPayloadSize))
+        {
+            corrupted = true;
+            break;
+        }
+
+        std::string payload(payloadSize, '\0');
+        is.read(payload.data(), payloadSize);
+        uint32_t checksum{0};
+        if ((is.gcount() != payloadSize) || !readRaw(is, checksum) ||
+            (checksum != getChecksum(payload)))
+        {
+            corrupted = true;
+            break;
+        }
+
+        uint8_t operation{0};
+        EntryRecordId entryRecordId{0};
+        PersistedEntry entry;
+        try
+        {
+            std::istringstream payloadStream(payload);
+            cereal::BinaryInputArchive iarchive(payloadStream);
+            iarchive(operation, entryRecordId, entry._entityPath,
+                     entry._elapsed);
+            if (version >= LogVersionWithEcoCore)
+            {
+                iarchive(entry._ecoCore);
+            }
+            if (version >= LogVersion)
+            {
+                iarchive(entry._inventoryPath, entry._errLogId,
+                         entry._bmcErrorLogPath, entry._generation);
+            }
+        }
+        catch (const cereal::Exception& e)
+        {
+            log<level::ERR>(std::format("Exception: [{}] during load the "
+                                        "hardware isolation entry log record",
+                                        e.what())
+                                .c_str());
+            corrupted = true;
+            break;
+        }
+
+        if (operation == static_cast<uint8_t>(Operation::Put))
+        {
+            _entries[entryRecordId] = std::move(entry);
+        }
+        else
+        {
+            _entries.erase(entryRecordId);
+        }
+        ++_numOfLogRecords;
+    }
+
+    if (corrupted)
+    {
+        // The partially written record (if any) is dropped by the compaction
+        log<level::ERR>(
+            std::format("The hardware isolation entry log [{}] is corrupted "
+                        "after [{}] records, ignoring the remaining records",
+                        _logPath.string(), _numOfLogRecords)
+                .c_str());
+        return false;
+    }
+
+    if (version != LogVersion)
+    {
+        // Rewrite the log in the current version
+        return false;
+    }
+
+    return _numOfLogRecords <= CompactionThreshold ||
+           _numOfLogRecords <= (2 * _entries.size());
+}
+
+std::vector<fs::path>
+    EntryLog::importLegacyEntries(const fs::path& legacyDirPath)
+{
+    std::vector<fs::path> importedFiles;
+    if (!fs::exists(legacyDirPath))
+    {
+        return importedFiles;
+    }
+
+    for (const auto& file : fs::directory_iterator(legacyDirPath))
+    {
+        try
+        {
+            auto entryRecordId = static_cast<EntryRecordId>(
+                std::stoul(file.path().filename()));
+
+            std::ifstream is(file.path(), std::ios::in | std::ios::binary);
+            cereal::BinaryInputArchive iarchive(is);
+
+            // The per entry file contains the Entry class version
+            // and then the entry members.
+            uint32_t classVersion{0};
+            PersistedEntry entry;
+            iarchive(classVersion, entry._entityPath, entry._elapsed);
+
+            _entries.emplace(entryRecordId, std::move(entry));
+            importedFiles.emplace_back(file.path());
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(
+                std::format("Exception: [{}] during import the hardware "
+                            "isolation entry from {}",
+                            e.what(), file.path().string())
+                    .c_str());
+        }
+    }
+
+    return importedFiles;
+}
+
+std::optional<PersistedEntry>
+    EntryLog::get(const EntryRecordId entryRecordId) const
+{
+    auto entryIt = _entries.find(entryRecordId);
+    if (entryIt == _entries.end())
+    {
+        return std::nullopt;
+    }
+    return entryIt->second;
+}
+
+const std::map<EntryRecordId, PersistedEntry>& EntryLog::getEntries() const
+{
+    return _entries;
+}
+
+void EntryLog::put(const EntryRecordId entryRecordId,
+                   const PersistedEntry& entry)
+{
+    auto entryIt = _entries.find(entryRecordId);
+    if ((entryIt != _entries.end()) && (entryIt->second == entry))
+    {
+        return;
+    }
+
+    _entries.insert_or_assign(entryRecordId, entry);
+    _pendingUpdates.insert_or_assign(entryRecordId, entry);
+    _writeBehind.markDirty(_writerId);
+}
+
+void EntryLog::erase(const EntryRecordId entryRecordId)
+{
+    if (_entries.erase(entryRecordId) == 0)
+    {
+        return;
+    }
+
+    _pendingUpdates.insert_or_assign(entryRecordId, std::nullopt);
+    _writeBehind.markDirty(_writerId);
+}
+
+void EntryLog::retain(const std::function<bool(EntryRecordId)>& keep)
+{
+    auto numOfErased = std::erase_if(
+        _entries, [&keep](const auto& entry) { return !keep(entry.first); });
+
+    if (numOfErased != 0)
+    {
+        _compactRequired = true;
+        _writeBehind.markDirty(_writerId);
+    }
+}
+
+void EntryLog::write()
+{
+    if (!_compactRequired)
+    {
+        for (const auto& [entryRecordId, entry] : _pendingUpdates)
+        {
+            if (entry.has_value())
+            {
+                writeRecord(_logStream, static_cast<uint8_t>(Operation::Put),
+                            entryRecordId, *entry);
+            }
+            else
+            {
+                writeRecord(_logStream, static_cast<uint8_t>(Operation::Erase),
+                            entryRecordId, PersistedEntry{});
+            }
+        }
+        _logStream.flush();
+
+        if (!_logStream.good() || !persist::syncPath(_logPath))
+        {
+            log<level::ERR>(
+                std::format("Failed to append [{}] hardware isolation entries "
+                            "into the log [{}], rewriting the log",
+                            _pendingUpdates.size(), _logPath.string())
+                    .c_str());
+            _compactRequired = true;
+        }
+        else
+        {
+            _numOfLogRecords += _pendingUpdates.size();
+        }
+    }
+    _pendingUpdates.clear();
+
+    if (_compactRequired || ((_numOfLogRecords > CompactionThreshold) &&
+                             (_numOfLogRecords > (2 * _entries.size()))))
+    {
+        compact();
+    }
+}
+
+bool EntryLog::compact()
+{
+    _logStream.close();
+
+    // Write into the temporary file and rename to avoid losing the entries
+    // if failed in between.
+    auto tmpLogPath = fs::path(_logPath).concat(".tmp");
+    bool written{false};
+    {
+        std::ofstream os(tmpLogPath, std::ios::binary | std::ios::trunc);
+        writeHeader(os);
+        for (const auto& [entryRecordId, entry] : _entries)
+        {
+            writeRecord(os, static_cast<uint8_t>(Operation::Put),
+                        entryRecordId, entry);
+        }
+        os.flush();
+        written = os.good();
+    }
+
+    bool compacted{written && persist::replaceFile(tmpLogPath, _logPath)};
+    if (!compacted)
+    {
+        log<level::ERR>(
+            std::format("Failed to compact the hardware isolation entry "
+                        "log [{}]",
+                        _logPath.string())
+                .c_str());
+        std::error_code ec;
+        fs::remove(tmpLogPath, ec);
+    }
+    else
+    {
+        _numOfLogRecords = _entries.size();
+        _compactRequired = false;
+    }
+
+    _logStream.open(_logPath, std::ios::binary | std::ios::app);
+    return compacted;
+}
+
+} // namespace entry_log
+} // namespace record
+} // namespace hw_isolation
@@ -9,9 +9,13 @@
 #include "common/error_log.hpp"
 
 #include <cereal/archives/binary.hpp>
+#include <cereal/types/set.hpp>
+#include <cereal/types/vector.hpp>
 #include <phosphor-logging/elog-errors.hpp>
 #include <xyz/openbmc_project/State/Chassis/server.hpp>
 
+#include <array>
+#include <chrono>
 #include <filesystem>
 #include <format>
 #include <fstream>
@@ -19,10 +23,6 @@
 #include <ranges>
 #include <sstream>
 
-// Associate Manager Class with version number
-constexpr uint32_t Cereal_ManagerClassVersion = 1;
-CEREAL_CLASS_VERSION(hw_isolation::record::Manager, Cereal_ManagerClassVersion);
-
 namespace hw_isolation
 {
 namespace record
@@ -35,126 +35,202 @@ constexpr auto HW_ISOLATION_ENTRY_MGR_PERSIST_PATH =
     "/var/lib/op-hw-isolation/persistdata/record_mgr/{}";
 
 Manager::Manager(sdbusplus::bus::bus& bus, const std::string& objPath,
-                 const sdeventplus::Event& eventLoop) :
-    type::ServerObject<CreateInterface, DeleteAllInterface>(bus,
-                                                            objPath.c_str()),
-    _bus(bus), _eventLoop(eventLoop), _isolatableHWs(bus),
+                 const sdeventplus::Event& eventLoop,
+                 persist::WriteBehind& writeBehind) :
+    type::ServerObject<CreateInterface, DeleteAllInterface,
+                       BulkCreateInterface, EntryQueryInterface,
+                       EntrySummaryInterface>(bus, objPath.c_str()),
+    _bus(bus), _eventLoop(eventLoop), _writeBehind(writeBehind),
+    _entryLog(HW_ISOLATION_ENTRY_LOG_PERSIST_PATH,
+              fs::path(HW_ISOLATION_ENTRY_PERSIST_PATH).parent_path(),
+              _writeBehind),
+    _devTreeGeneration(devtree::getDevTreeGeneration()),
+    _isolatableHWs(bus),
     _guardFileWatch(
         eventLoop.get(), IN_NONBLOCK, IN_CLOSE_WRITE, EPOLLIN,
         openpower_guard::getGuardFilePath(),
         std::bind(std::mem_fn(&hw_isolation::record::Manager::
                                   processHardwareIsolationRecordFile),
+                  this)),
+    _guardFileDebounce(
+        eventLoop,
+        std::chrono::milliseconds(GUARD_FILE_DEBOUNCE_QUIET_PERIOD_MS),
+        std::chrono::milliseconds(GUARD_FILE_DEBOUNCE_MAX_LATENCY_MS),
+        std::bind(std::mem_fn(&hw_isolation::record::Manager::
+                                  handleGuardFileUpdates),
                   this))
 {
-    fs::create_directories(
-        fs::path(HW_ISOLATION_ENTRY_PERSIST_PATH).parent_path());
+    importPersistedEcoCores();
+}
 
-    deserialize();
+entry_log::EntryLog& Manager::getEntryLog()
+{
+    return _entryLog;
 }
 
-void Manager::serialize()
+uint64_t Manager::getDevTreeGeneration() const
 {
-    fs::path path{
-        std::format(HW_ISOLATION_ENTRY_MGR_PERSIST_PATH, "eco_cores")};
+    return _devTreeGeneration;
+}
+
+void Manager::subscribe(EntryChangeSubscriber subscriber)
+{
+    _entryChangeSubscribers.emplace_back(std::move(subscriber));
+}
 
-    if (_persistedEcoCores.empty())
+void Manager::publishEntryChange(const EntryChangeType type,
+                                 const entry::EntryRecordId entryRecordId,
+                                 const entry::Entry& entry)
+{
+    if (_entryChangeSubscribers.empty())
     {
-        fs::remove(path);
         return;
     }
 
-    fs::create_directories(path.parent_path());
-    try
+    EntryChange change{type, entryRecordId, entry.getIsolatedHwInvPath(),
+                       entry.getEntityPath()};
+    for (const auto& subscriber : _entryChangeSubscribers)
     {
-        std::ofstream os(path.c_str(), std::ios::binary);
-        cereal::BinaryOutputArchive oarchive(os);
-        oarchive(*this);
-    }
-    catch (const cereal::Exception& e)
-    {
-        log<level::ERR>(std::format("Exception: [{}] during serialize the "
-                                    "eco cores physical path into {}",
-                                    e.what(), path.string())
-                            .c_str());
-        fs::remove(path);
+        subscriber(change);
     }
 }
 
-bool Manager::deserialize()
+void Manager::summarizeEntry(const entry::EntryRecordId entryRecordId,
+                             const entry::Entry* entry)
 {
-    fs::path path{
-        std::format(HW_ISOLATION_ENTRY_MGR_PERSIST_PATH, "eco_cores")};
-    try
+    if (auto summarizedIt = _summarizedEntries.find(entryRecordId);
+        summarizedIt != _summarizedEntries.end())
     {
-        if (fs::exists(path))
+        const auto& [severity, resolved] = summarizedIt->second;
+        if (resolved)
         {
-            std::ifstream is(path.c_str(), std::ios::in | std::ios::binary);
-            cereal::BinaryInputArchive iarchive(is);
-            iarchive(*this);
-            return true;
+            --_numOfResolvedEntries;
         }
-        return false;
+        else if (auto countIt = _unresolvedEntriesBySeverity.find(severity);
+                 (countIt != _unresolvedEntriesBySeverity.end()) &&
+                 (--countIt->second == 0))
+        {
+            _unresolvedEntriesBySeverity.erase(countIt);
+        }
+        _summarizedEntries.erase(summarizedIt);
     }
-    catch (const cereal::Exception& e)
+
+    if (entry != nullptr)
     {
-        log<level::ERR>(std::format("Exception: [{}] during deserialize the "
-                                    "eco cores physical path into {}",
-                                    e.what(), path.string())
-                            .c_str());
-        fs::remove(path);
-        return false;
+        if (entry->resolved())
+        {
+            ++_numOfResolvedEntries;
+        }
+        else
+        {
+            ++_unresolvedEntriesBySeverity[entry->severity()];
+        }
+        _summarizedEntries.emplace(entryRecordId,
+                                   std::make_pair(entry->severity(),
+                                                  entry->resolved()));
     }
-}
 
-void Manager::updateEcoCoresList(
-    const bool ecoCore, const devtree::DevTreePhysPath& coreDevTreePhysPath)
-{
-    if (ecoCore)
+    if (!_summarySource)
     {
-        _persistedEcoCores.emplace(coreDevTreePhysPath);
+        _summarySource = std::make_unique<sdeventplus::source::Defer>(
+            _eventLoop, [this](sdeventplus::source::EventBase&) {
+            this->publishEntrySummary();
+        });
+        // Publish once the batch of changes is done
+        _summarySource->set_priority(SD_EVENT_PRIORITY_IDLE);
     }
     else
     {
-        _persistedEcoCores.erase(coreDevTreePhysPath);
+        _summarySource->set_enabled(sdeventplus::source::Enabled::On);
     }
-    serialize();
 }
 
-std::optional<uint32_t>
-    Manager::getEID(const sdbusplus::message::object_path& bmcErrorLog) const
+void Manager::publishEntrySummary()
 {
-    try
+    // The source can't be released from its own callback so,
+    // just disable it.
+    _summarySource->set_enabled(sdeventplus::source::Enabled::Off);
+
+    uint32_t numOfUnresolvedEntries{0};
+    std::map<std::string, uint32_t> unresolvedEntriesBySeverity;
+    for (const auto& [severity, count] : _unresolvedEntriesBySeverity)
     {
-        uint32_t eid;
+        unresolvedEntriesBySeverity.emplace(
+            entry::EntryInterface::convertTypeToString(severity), count);
+        numOfUnresolvedEntries += count;
+    }
 
-        auto dbusServiceName = utils::getDBusServiceName(
-            _bus, type::LoggingObjectPath, type::LoggingInterface);
+    entries(numOfUnresolvedEntries);
+    resolvedEntries(_numOfResolvedEntries);
+    entriesBySeverity(std::move(unresolvedEntriesBySeverity));
+}
+
+void Manager::importPersistedEcoCores()
+{
+    fs::path path{
+        std::format(HW_ISOLATION_ENTRY_MGR_PERSIST_PATH, "eco_cores")};
+    if (!fs::exists(path))
+    {
+        return;
+    }
 
-        auto method = _bus.new_method_call(
-            dbusServiceName.c_str(), type::LoggingObjectPath,
-            type::LoggingInterface, "GetPELIdFromBMCLogId");
+    try
+    {
+        std::ifstream is(path.c_str(), std::ios::in | std::ios::binary);
+        cereal::BinaryInputArchive iarchive(is);
 
-        method.append(static_cast<uint32_t>(std::stoi(bmcErrorLog.filename())));
-        auto resp = _bus.call(method);
+        // The file contains the Manager class version and then
+        // the ECO cores physical path.
+        uint32_t classVersion{0};
+        std::set<devtree::DevTreePhysPath> ecoCores;
+        iarchive(classVersion, ecoCores);
 
-        resp.read(eid);
-        return eid;
+        for (auto [entryRecordId, entry] : _entryLog.getEntries())
+        {
+            if (ecoCores.contains(entry._entityPath) && !entry._ecoCore)
+            {
+                entry._ecoCore = true;
+                _entryLog.put(entryRecordId, entry);
+            }
+        }
     }
-    catch (const sdbusplus::exception::SdBusError& e)
+    catch (const cereal::Exception& e)
     {
-        log<level::ERR>(std::format("Exception [{}] to get EID (aka PEL ID) "
-                                    "for object [{}]",
-                                    e.what(), bmcErrorLog.str)
+        log<level::ERR>(std::format("Exception: [{}] during import the "
+                                    "eco cores physical path from {}",
+                                    e.what(), path.string())
                             .c_str());
     }
-    return std::nullopt;
+    fs::remove(path);
+}
+
+bool Manager::isPersistedEcoCore(
+    const entry::EntryRecordId recordId,
+    const devtree::DevTreePhysPath& entityPathRawData)
+{
+    const auto& persistedEntries = _entryLog.getEntries();
+    if (auto persistedEntry = persistedEntries.find(recordId);
+        (persistedEntry != persistedEntries.end()) &&
+        (persistedEntry->second._entityPath == entityPathRawData))
+    {
+        return persistedEntry->second._ecoCore;
+    }
+
+    // The record might be recreated for the same core with the different
+    // record id so, look by the physical path as well.
+    return std::ranges::any_of(persistedEntries,
+                               [&entityPathRawData](const auto& entry) {
+        return entry.second._ecoCore &&
+               (entry.second._entityPath == entityPathRawData);
+    });
 }
 
 std::optional<sdbusplus::message::object_path> Manager::createEntry(
     const entry::EntryRecordId& recordId, const entry::EntryResolved& resolved,
     const entry::EntrySeverity& severity, const std::string& isolatedHardware,
     const std::string& bmcErrorLog, const bool deleteRecord,
-    const openpower_guard::EntityPath& entityPath)
+    const openpower_guard::EntityPath& entityPath,
+    const entry::EntryErrLogId errLogId, const bool deferred)
 {
     try
     {
@@ -180,12 +256,31 @@ std::optional<sdbusplus::message::object_path> Manager::createEntry(
                 bmcErrorLogFwdType, bmcErrorLogRevType, bmcErrorLog));
         }
 
-        _isolatedHardwares.insert(std::make_pair(
-            recordId, std::make_unique<entry::Entry>(
-                          _bus, entryObjPath, *this, recordId, severity,
-                          resolved, associationDeftoHw, entityPath)));
+        if (_isolatedHardwares
+                .insert(std::make_pair(
+                    recordId,
+                    std::make_unique<entry::Entry>(
+                        _bus, entryObjPath, *this, recordId, severity,
+                        resolved, associationDeftoHw, entityPath, errLogId,
+                        deferred)))
+                .second)
+        {
+            indexEntry(recordId, isolatedHardware);
+            summarizeEntry(recordId, _isolatedHardwares[recordId].get());
+
+            // The restored entries are not changed so, notify only
+            // the entries which are created after restored.
+            if (!_restoreCtx && !resolved)
+            {
+                publishEntryChange(EntryChangeType::Added, recordId,
+                                   *_isolatedHardwares[recordId]);
+            }
+        }
 
-        utils::setEnabledProperty(_bus, isolatedHardware, resolved);
+        if (!deferred)
+        {
+            utils::setEnabledProperty(_bus, isolatedHardware, resolved);
+        }
 
         // Update the last entry id by using the created entry id.
         return entryObjPath.string();
@@ -204,10 +299,54 @@ std::optional<sdbusplus::message::object_path> Manager::createEntry(
     return std::nullopt;
 }
 
+void Manager::completeDeferredEntries(
+    const std::vector<entry::EntryRecordId>& entryRecordIds)
+{
+    std::vector<std::string> isolatedHwsToDisable;
+    std::vector<std::string> isolatedHwsToEnable;
+    for (const auto& entryRecordId : entryRecordIds)
+    {
+        auto entryIt = _isolatedHardwares.find(entryRecordId);
+        if (entryIt == _isolatedHardwares.end())
+        {
+            continue;
+        }
+
+        for (const auto& assoc : entryIt->second->associations())
+        {
+            if (std::get<0>(assoc) == "isolated_hw")
+            {
+                if (entryIt->second->resolved())
+                {
+                    isolatedHwsToEnable.emplace_back(std::get<2>(assoc));
+                }
+                else
+                {
+                    isolatedHwsToDisable.emplace_back(std::get<2>(assoc));
+                }
+                break;
+            }
+        }
+    }
+
+    utils::setEnabledProperties(_bus, isolatedHwsToDisable, false);
+    utils::setEnabledProperties(_bus, isolatedHwsToEnable, true);
+
+    for (const auto& entryRecordId : entryRecordIds)
+    {
+        if (auto entryIt = _isolatedHardwares.find(entryRecordId);
+            entryIt != _isolatedHardwares.end())
+        {
+            entryIt->second->emit_object_added();
+        }
+    }
+}
+
 std::pair<bool, sdbusplus::message::object_path> Manager::updateEntry(
     const entry::EntryRecordId& recordId, const entry::EntrySeverity& severity,
     const std::string& isolatedHwDbusObjPath, const std::string& bmcErrorLog,
-    const openpower_guard::EntityPath& entityPath)
+    const openpower_guard::EntityPath& entityPath,
+    const entry::EntryErrLogId errLogId)
 {
     auto isolatedHwIt =
         std::find_if(_isolatedHardwares.begin(), _isolatedHardwares.end(),
@@ -222,6 +361,10 @@ std::pair<bool, sdbusplus::message::object_path> Manager::updateEntry(
         return std::make_pair(false, std::string());
     }
 
+    // The entry is updated by using the latest record so, the pending host
+    // changes of the entry are stale.
+    dropPendingChanges(isolatedHwIt->first);
+
     // Add association for isolated hardware inventory path
     // Note: Association forward and reverse type are defined as per
     // hardware isolation design document (aka guard) and hardware isolation
@@ -247,14 +390,23 @@ std::pair<bool, sdbusplus::message::object_path> Manager::updateEntry(
     if (isolatedHwIt->second->severity() != severity)
     {
         isolatedHwIt->second->severity(severity);
+        summarizeEntry(isolatedHwIt->first, isolatedHwIt->second.get());
+        publishEntryChange(EntryChangeType::SeverityChanged,
+                           isolatedHwIt->first, *isolatedHwIt->second);
         updated = true;
     }
 
     if (isolatedHwIt->second->associations() != associationDeftoHw)
     {
+        unindexEntry(isolatedHwIt->first,
+                     isolatedHwIt->second->getIsolatedHwInvPath());
         isolatedHwIt->second->associations(associationDeftoHw);
+        indexEntry(isolatedHwIt->first, isolatedHwDbusObjPath);
+        publishEntryChange(EntryChangeType::ErrorLogChanged,
+                           isolatedHwIt->first, *isolatedHwIt->second);
         updated = true;
     }
+    isolatedHwIt->second->setEntryErrLogId(errLogId);
 
     if (updated)
     {
@@ -307,8 +459,15 @@ sdbusplus::message::object_path Manager::create(
     sdbusplus::xyz::openbmc_project::HardwareIsolation::server::Entry::Type
         severity)
 {
+    drainRestore();
     isHwIsolationAllowed(severity);
 
+    if (auto entryPath = getIsolatedEntry(isolateHardware.str, severity, "");
+        entryPath.has_value())
+    {
+        return *entryPath;
+    }
+
     auto devTreePhysicalPath = _isolatableHWs.getPhysicalPath(isolateHardware);
     if (!devTreePhysicalPath.has_value())
     {
@@ -334,7 +493,8 @@ sdbusplus::message::object_path Manager::create(
         0, *guardType);
 
     if (auto ret = updateEntry(guardRecord->recordId, severity,
-                               isolateHardware.str, "", guardRecord->targetId);
+                               isolateHardware.str, "", guardRecord->targetId,
+                               0);
         ret.first == true)
     {
         return ret.second;
@@ -343,7 +503,7 @@ sdbusplus::message::object_path Manager::create(
     {
         auto entryPath = createEntry(guardRecord->recordId, false, severity,
                                      isolateHardware.str, "", true,
-                                     guardRecord->targetId);
+                                     guardRecord->targetId, 0);
 
         if (!entryPath.has_value())
         {
@@ -359,8 +519,16 @@ sdbusplus::message::object_path Manager::createWithErrorLog(
         severity,
     sdbusplus::message::object_path bmcErrorLog)
 {
+    drainRestore();
     isHwIsolationAllowed(severity);
 
+    if (auto entryPath = getIsolatedEntry(isolateHardware.str, severity,
+                                          bmcErrorLog.str);
+        entryPath.has_value())
+    {
+        return *entryPath;
+    }
+
     auto devTreePhysicalPath = _isolatableHWs.getPhysicalPath(isolateHardware);
     if (!devTreePhysicalPath.has_value())
     {
@@ -396,7 +564,7 @@ sdbusplus::message::object_path Manager::createWithErrorLog(
 
     if (auto ret = updateEntry(guardRecord->recordId, severity,
                                isolateHardware.str, bmcErrorLog.str,
-                               guardRecord->targetId);
+                               guardRecord->targetId, *eId);
         ret.first == true)
     {
         return ret.second;
@@ -405,7 +573,7 @@ sdbusplus::message::object_path Manager::createWithErrorLog(
     {
         auto entryPath = createEntry(guardRecord->recordId, false, severity,
                                      isolateHardware.str, bmcErrorLog.str, true,
-                                     guardRecord->targetId);
+                                     guardRecord->targetId, *eId);
 
         if (!entryPath.has_value())
         {
@@ -415,38 +583,159 @@ sdbusplus::message::object_path Manager::createWithErrorLog(
     }
 }
 
-void Manager::eraseEntry(const entry::EntryRecordId entryRecordId)
+std::vector<BulkCreateResult>
+    Manager::createBulk(std::vector<BulkCreateItem> hardwares)
 {
-    if (_isolatedHardwares.contains(entryRecordId))
+    drainRestore();
+
+    std::vector<BulkCreateResult> results(
+        hardwares.size(),
+        std::make_tuple(sdbusplus::message::object_path("/"), std::string()));
+
+    if (hardwares.empty())
     {
-        updateEcoCoresList(
-            false, devtree::convertEntityPathIntoRawData(
-                       _isolatedHardwares.at(entryRecordId)->getEntityPath()));
+        return results;
     }
-    _isolatedHardwares.erase(entryRecordId);
-}
 
-void Manager::clearDbusEntries()
-{
-    auto entryIt = _isolatedHardwares.begin();
-    while (entryIt != _isolatedHardwares.end())
+    // The policy is same for all given hardware so, check once.
+    // The manual isolation has additional checks so, use it if requested.
+    auto manualIsolation = std::ranges::any_of(hardwares, [](const auto& hw) {
+        return std::get<1>(hw) == entry::EntrySeverity::Manual;
+    });
+    isHwIsolationAllowed(manualIsolation ? entry::EntrySeverity::Manual
+                                         : std::get<1>(hardwares.front()));
+
+    // Resolve all given hardware before writing any guard record.
+    std::vector<openpower_guard::GuardRecordToCreate> recordsToCreate;
+    std::vector<std::tuple<size_t, entry::EntryErrLogId>> resolvedHwIndexes;
+    for (size_t index = 0; index < hardwares.size(); ++index)
+    {
+        const auto& [isolateHardware, severity, bmcErrorLog] = hardwares[index];
+
+        auto devTreePhysicalPath =
+            _isolatableHWs.getPhysicalPath(isolateHardware);
+        if (!devTreePhysicalPath.has_value())
+        {
+            log<level::ERR>(
+                std::format("Invalid argument [IsolateHardware: {}]",
+                            isolateHardware.str)
+                    .c_str());
+            std::get<1>(results[index]) =
+                type::CommonError::InvalidArgument().name();
+            continue;
+        }
+
+        entry::EntryErrLogId eId{0};
+        if (bmcErrorLog.str != "/")
+        {
+            auto errLogId = getEID(bmcErrorLog);
+            if (!errLogId.has_value())
+            {
+                log<level::ERR>(
+                    std::format("Invalid argument [BmcErrorLog: {}]",
+                                bmcErrorLog.str)
+                        .c_str());
+                std::get<1>(results[index]) =
+                    type::CommonError::InvalidArgument().name();
+                continue;
+            }
+            eId = *errLogId;
+        }
+
+        auto guardType = entry::utils::getGuardType(severity);
+        if (!guardType.has_value())
+        {
+            log<level::ERR>(
+                std::format(
+                    "Invalid argument [Severity: {}]",
+                    entry::EntryInterface::convertTypeToString(severity))
+                    .c_str());
+            std::get<1>(results[index]) =
+                type::CommonError::InvalidArgument().name();
+            continue;
+        }
+
+        recordsToCreate.emplace_back(
+            openpower_guard::EntityPath(devTreePhysicalPath->data(),
+                                        devTreePhysicalPath->size()),
+            eId, *guardType);
+        resolvedHwIndexes.emplace_back(index, eId);
+    }
+
+    auto createdRecords = openpower_guard::createBatch(recordsToCreate);
+
+    // Defer the created entries completion to do all together.
+    std::vector<entry::EntryRecordId> createdEntries;
+    for (size_t recIndex = 0; recIndex < createdRecords.size(); ++recIndex)
     {
-        auto entryRecordId = entryIt->first;
-        auto& entry = entryIt->second;
-        std::advance(entryIt, 1);
+        const auto& [index, eId] = resolvedHwIndexes[recIndex];
+        const auto& [isolateHardware, severity, bmcErrorLog] = hardwares[index];
+        auto& [entryPath, errorName] = results[index];
+
+        if (std::holds_alternative<std::string>(createdRecords[recIndex]))
+        {
+            errorName = std::get<std::string>(createdRecords[recIndex]);
+            continue;
+        }
 
-        // Continue other entries to delete if failed to delete one entry
+        const auto& guardRecord =
+            std::get<openpower_guard::GuardRecord>(createdRecords[recIndex]);
+        auto bmcErrorLogPath = (eId == 0) ? std::string() : bmcErrorLog.str;
         try
         {
-            entry->resolveEntry(false);
+            if (auto ret = updateEntry(guardRecord.recordId, severity,
+                                       isolateHardware.str, bmcErrorLogPath,
+                                       guardRecord.targetId, eId);
+                ret.first == true)
+            {
+                entryPath = ret.second;
+                continue;
+            }
+
+            auto createdEntryPath = createEntry(
+                guardRecord.recordId, false, severity, isolateHardware.str,
+                bmcErrorLogPath, true, guardRecord.targetId, eId, true);
+            if (!createdEntryPath.has_value())
+            {
+                errorName = type::CommonError::InternalFailure().name();
+                continue;
+            }
+
+            entryPath = *createdEntryPath;
+            createdEntries.emplace_back(guardRecord.recordId);
         }
-        catch (std::exception& e)
+        catch (const std::exception& e)
         {
-            log<level::ERR>(std::format("Exception [{}] to delete entry [{}]",
-                                        e.what(), entryRecordId)
-                                .c_str());
+            log<level::ERR>(
+                std::format("Exception [{}], so failed to isolate the "
+                            "hardware [{}]",
+                            e.what(), isolateHardware.str)
+                    .c_str());
+            errorName = type::CommonError::InternalFailure().name();
         }
     }
+
+    completeDeferredEntries(createdEntries);
+
+    return results;
+}
+
+void Manager::eraseEntry(const entry::EntryRecordId entryRecordId)
+{
+    // The record is cleared so, the pending host changes of the entry
+    // are stale.
+    dropPendingChanges(entryRecordId);
+
+    // The ECO core flag is removed along with the persisted entry.
+    if (auto entryIt = _isolatedHardwares.find(entryRecordId);
+        entryIt != _isolatedHardwares.end())
+    {
+        publishEntryChange(EntryChangeType::Resolved, entryRecordId,
+                           *entryIt->second);
+        unindexEntry(entryRecordId, entryIt->second->getIsolatedHwInvPath());
+        summarizeEntry(entryRecordId, nullptr);
+        _isolatedHardwares.erase(entryIt);
+    }
 }
 
 void Manager::deleteAll()
@@ -456,17 +745,22 @@ void Manager::deleteAll()
     // Instead of waiting for guard file update, immediately refesh the dbus entries
     // with the number of records in the guard file
     hw_isolation::utils::isHwDeisolationAllowed(_bus);
+    drainRestore();
     try
     {
-        // remove the watch, as clearall is allowed only when the host is powered off
-        // as we dont want inotify signals to come again
-        _guardFileWatch.removeWatch();
+        // The cleared entries are resolved in one batch as part of the
+        // refresh. The guard file update notification for the own write
+        // arrives after returning and, it is ignored once debounced since,
+        // the refresh marks the records as reconciled (see isReconciled).
         openpower_guard::clearAll();
         handleHostIsolatedHardwares();
-        _guardFileWatch.addWatch();
+
+        // Make sure the cleared entries are not restored if the service
+        // is restarted after returning.
+        _writeBehind.flush();
     }
-    //If there is any error in adding/ removing watch runtime_error will be generated
-    //Create a PEL during that scenario  
+    //If there is any runtime_error while refreshing the entries
+    //Create a PEL during that scenario
     catch (const std::runtime_error& e) 
     {
         //create error pel and then throw the exception
@@ -483,12 +777,7 @@ void Manager::deleteAll()
 
 bool Manager::isValidRecord(const entry::EntryRecordId recordId)
 {
-    if (recordId != 0xFFFFFFFF)
-    {
-        return true;
-    }
-
-    return false;
+    return openpower_guard::isValidRecord(recordId);
 }
 
 void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
@@ -510,8 +799,8 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
             resolved = true;
         }
 
-        bool ecoCore{
-            (_persistedEcoCores.contains(entityPathRawData) && isRestorePath)};
+        bool ecoCore{isRestorePath &&
+                     isPersistedEcoCore(record.recordId, entityPathRawData)};
 
         auto isolatedHwInventoryPath =
             _isolatableHWs.getInventoryPath(entityPathRawData, ecoCore);
@@ -524,9 +813,9 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
                     "hardware [{}] : Due to failure to get inventory path",
                     ss.str())
                     .c_str());
+            addPendingRecord(record.recordId, entityPathRawData);
             return;
         }
-        updateEcoCoresList(ecoCore, entityPathRawData);
 
         auto bmcErrorLogPath = utils::getBMCLogPath(_bus, record.elogId);
         std::string strBmcErrorLogPath{};
@@ -548,7 +837,7 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
         auto entryPath = createEntry(record.recordId, resolved, *entrySeverity,
                                      isolatedHwInventoryPath->str,
                                      strBmcErrorLogPath, false,
-                                     record.targetId);
+                                     record.targetId, record.elogId);
 
         if (!entryPath.has_value())
         {
@@ -560,6 +849,8 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
                     .c_str());
             return;
         }
+        _isolatedHardwares.at(record.recordId)->setEcoCore(ecoCore);
+        removePendingRecord(record.recordId);
     }
     catch (const std::exception& e)
     {
@@ -571,57 +862,49 @@ void Manager::createEntryForRecord(const openpower_guard::GuardRecord& record,
     }
 }
 
-void Manager::updateEntryForRecord(const openpower_guard::GuardRecord& record,
-                                   IsolatedHardwares::iterator& entryIt)
+void Manager::updateEntrySeverity(const openpower_guard::GuardRecord& record,
+                                  IsolatedHardwares::iterator& entryIt)
 {
-    auto entityPathRawData =
-        devtree::convertEntityPathIntoRawData(record.targetId);
-    std::stringstream ss;
-    std::for_each(entityPathRawData.begin(), entityPathRawData.end(),
-                  [&ss](const auto& ele) {
-        ss << std::setw(2) << std::setfill('0') << std::hex << (int)ele << " ";
-    });
-
-    bool ecoCore{false};
-
-    auto isolatedHwInventoryPath =
-        _isolatableHWs.getInventoryPath(entityPathRawData, ecoCore);
-
-    if (!isolatedHwInventoryPath.has_value())
-    {
-        log<level::ERR>(
-            std::format("Skipping to restore a given isolated "
-                        "hardware [{}] : Due to failure to get inventory path",
-                        ss.str())
-                .c_str());
-        return;
-    }
-    updateEcoCoresList(ecoCore, entityPathRawData);
-
-    auto bmcErrorLogPath = utils::getBMCLogPath(_bus, record.elogId);
-
     auto entrySeverity = entry::utils::getEntrySeverityType(
         static_cast<openpower_guard::GardType>(record.errType));
     if (!entrySeverity.has_value())
     {
         log<level::ERR>(
-            std::format("Skipping to restore a given isolated "
-                        "hardware [{}] : Due to failure to to get BMC "
-                        "EntrySeverity by isolated hardware GardType [{}]",
-                        ss.str(), record.errType)
+            std::format("Skipping to update the severity of the entry [{}] : "
+                        "Due to failure to to get BMC EntrySeverity by "
+                        "isolated hardware GardType [{}]",
+                        entryIt->first, record.errType)
                 .c_str());
         return;
     }
 
-    // Add association for isolated hardware inventory path
-    // Note: Association forward and reverse type are defined as per
-    // hardware isolation design document (aka guard) and hardware isolation
-    // entry dbus interface document for hardware and error object path
-    type::AsscDefFwdType isolateHwFwdType("isolated_hw");
-    type::AsscDefRevType isolatedHwRevType("isolated_hw_entry");
+    entryIt->second->severity(*entrySeverity);
+    summarizeEntry(entryIt->first, entryIt->second.get());
+
+    // Existing entry might be overwritten if that's meets certain
+    // overwritten conditions so update creation time.
+    std::time_t timeStamp = std::time(nullptr);
+    entryIt->second->elapsed(timeStamp);
+
+    entryIt->second->serialize();
+
+    publishEntryChange(EntryChangeType::SeverityChanged, entryIt->first,
+                       *entryIt->second);
+}
+
+void Manager::updateEntryErrorLog(const openpower_guard::GuardRecord& record,
+                                  IsolatedHardwares::iterator& entryIt)
+{
+    auto bmcErrorLogPath = utils::getBMCLogPath(_bus, record.elogId);
+
+    // Keep all the associations except the error log association
+    // since only the error log is changed in the record.
     type::AssociationDef associationDeftoHw;
-    associationDeftoHw.push_back(std::make_tuple(
-        isolateHwFwdType, isolatedHwRevType, *isolatedHwInventoryPath));
+    std::ranges::copy_if(entryIt->second->associations(),
+                         std::back_inserter(associationDeftoHw),
+                         [](const auto& assoc) {
+        return std::get<0>(assoc) != "isolated_hw_errorlog";
+    });
 
     // Add errog log as Association if given
     if (!bmcErrorLogPath->str.empty())
@@ -632,284 +915,1289 @@ void Manager::updateEntryForRecord(const openpower_guard::GuardRecord& record,
             bmcErrorLogFwdType, bmcErrorLogRevType, *bmcErrorLogPath));
     }
 
-    bool updated{false};
-    if (entryIt->second->severity() != entrySeverity)
-    {
-        entryIt->second->severity(*entrySeverity);
-        updated = true;
-    }
-
     if (entryIt->second->associations() != associationDeftoHw)
     {
         entryIt->second->associations(associationDeftoHw);
-        updated = true;
     }
+    entryIt->second->setEntryErrLogId(record.elogId);
 
-    utils::setEnabledProperty(_bus, *isolatedHwInventoryPath, false);
-
-    if (updated)
-    {
-        // Existing entry might be overwritten if that's meets certain
-        // overwritten conditions so update creation time.
-        std::time_t timeStamp = std::time(nullptr);
-        entryIt->second->elapsed(timeStamp);
-    }
+    // Existing entry might be overwritten if that's meets certain
+    // overwritten conditions so update creation time.
+    std::time_t timeStamp = std::time(nullptr);
+    entryIt->second->elapsed(timeStamp);
 
     entryIt->second->serialize();
+
+    publishEntryChange(EntryChangeType::ErrorLogChanged, entryIt->first,
+                       *entryIt->second);
 }
 
-void Manager::cleanupPersistedEcoCores()
+void Manager::resolveEntries(
+    const std::vector<entry::EntryRecordId>& entryRecordIds)
 {
-    bool updated{false};
-    if (_isolatedHardwares.empty())
-    {
-        _persistedEcoCores.clear();
-        updated = true;
-    }
-    else
+    std::vector<IsolatedHardwares::iterator> entriesToRemove;
+    std::vector<std::string> isolatedHwsToEnable;
+
+    for (const auto& entryRecordId : entryRecordIds)
     {
-        for (auto ecoCore = _persistedEcoCores.begin();
-             ecoCore != _persistedEcoCores.end();)
+        auto entryIt = _isolatedHardwares.find(entryRecordId);
+        if ((entryIt == _isolatedHardwares.end()) ||
+            entryIt->second->resolved())
         {
-            auto nextEcoCore = std::next(ecoCore, 1);
+            continue;
+        }
 
-            auto isNotIsolated = std::ranges::none_of(
-                _isolatedHardwares, [ecoCore](const auto& entry) {
-                return (entry.second->getEntityPath() ==
-                        openpower_guard::EntityPath(ecoCore->data(),
-                                                    ecoCore->size()));
-            });
+        // Skip the property signal since the entry is going to remove.
+        entryIt->second->resolved(true, true);
 
-            if (isNotIsolated)
+        for (const auto& assoc : entryIt->second->associations())
+        {
+            if (std::get<0>(assoc) == "isolated_hw")
             {
-                updateEcoCoresList(false, *ecoCore);
-                updated = true;
+                isolatedHwsToEnable.emplace_back(std::get<2>(assoc));
+                break;
             }
-
-            ecoCore = nextEcoCore;
         }
+
+        entriesToRemove.emplace_back(entryIt);
     }
 
-    if (updated)
+    if (entriesToRemove.empty())
     {
-        serialize();
+        return;
     }
+
+    utils::setEnabledProperties(_bus, isolatedHwsToEnable, true);
+
+    // The persisted entry (along with the ECO core flag) will be removed
+    // and, the object removed signal will be emitted while destructing
+    // the entry so, do it at the end to emit the signals together.
+    std::ranges::for_each(entriesToRemove, [this](const auto& entryIt) {
+        publishEntryChange(EntryChangeType::Resolved, entryIt->first,
+                           *entryIt->second);
+        unindexEntry(entryIt->first, entryIt->second->getIsolatedHwInvPath());
+        summarizeEntry(entryIt->first, nullptr);
+        _isolatedHardwares.erase(entryIt);
+    });
 }
 
-void Manager::cleanupPersistedFiles()
+void Manager::applyChangeSet(diff::ChangeSet changeSet)
 {
-    auto deletePersistedEntryFileIfNotExist = [this](const auto& file) {
-        auto fileEntryId = std::stoul(file.path().filename());
-
-        if (!(this->_isolatedHardwares.contains(fileEntryId)))
+    // Resolve all the removed entries in a batch
+    std::vector<entry::EntryRecordId> removedEntries;
+    for (const auto& change : changeSet)
+    {
+        if (change._type == diff::ChangeType::Removed)
         {
-            fs::remove(file.path());
+            removedEntries.emplace_back(change._entryRecordId);
         }
-    };
-
-    std::ranges::for_each(
-        fs::directory_iterator(
-            fs::path(HW_ISOLATION_ENTRY_PERSIST_PATH).parent_path()),
-        deletePersistedEntryFileIfNotExist);
-
-    cleanupPersistedEcoCores();
-}
-
-void Manager::restore()
-{
-    // Don't get ephemeral records (GARD_Reconfig and GARD_Sticky_deconfig
-    // because those type records are created for internal purpose to use
-    // by BMC and Hostboot
-    openpower_guard::GuardRecords records = openpower_guard::getAll(true);
+    }
 
-    auto validRecord = [this](const auto& record) {
-        return this->isValidRecord(record.recordId);
-    };
+    try
+    {
+        resolveEntries(removedEntries);
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(std::format("Exception [{}] : Failed to resolve [{}] "
+                                    "entries in a batch",
+                                    e.what(), removedEntries.size())
+                            .c_str());
 
-    auto validRecords = records | std::views::filter(validRecord);
+        // Reconcile again with the next guard file update
+        openpower_guard::resetReconciledRecords();
+    }
 
-    auto createEntry = [this](const auto& record) {
-        this->createEntryForRecord(record, true);
-    };
+    std::erase_if(changeSet, [](const auto& change) {
+        return change._type == diff::ChangeType::Removed;
+    });
+    _changesToApply = std::move(changeSet);
+    _nextChange = 0;
 
-    std::ranges::for_each(validRecords, createEntry);
+    if (_changesToApply.empty())
+    {
+        if (_reconcileSource)
+        {
+            _reconcileSource->set_enabled(sdeventplus::source::Enabled::Off);
+        }
+        return;
+    }
 
-    cleanupPersistedFiles();
+    if (!_reconcileSource)
+    {
+        _reconcileSource = std::make_unique<sdeventplus::source::Defer>(
+            _eventLoop, [this](sdeventplus::source::EventBase&) {
+            this->applyPendingChanges();
+        });
+        // Let the requests and signals go first
+        _reconcileSource->set_priority(SD_EVENT_PRIORITY_IDLE);
+    }
+    else
+    {
+        _reconcileSource->set_enabled(sdeventplus::source::Enabled::On);
+    }
 }
 
-void Manager::processHardwareIsolationRecordFile()
+void Manager::applyChange(const diff::Change& change)
 {
-    /**
-     * Start timer in the event loop to get the final isolated hardware
-     * record list which are updated by the host because of the atomicity
-     * on the partition file (which is used to store isolated hardware details)
-     * between BMC and Host.
-     */
     try
     {
-        // The handleHostIsolatedHardwares method is called after 5 seconds to
-        // handle atomicity in the guard file operations. Within this time
-        // window, if there are multiple updates to the guard file, process all
-        // of them together. We need not add another timer object to process the
-        // new information, as the earlier information is not yet processed and
-        // could be done together. In every iteration we process and update all
-        // the guard records. This will optimize the time consumed when there
-        // are multiple guard records created.
-        if (_timerObjs.empty())
-        {
-            _timerObjs.emplace(std::make_unique<sdeventplus::utility::Timer<
-                                   sdeventplus::ClockId::Monotonic>>(
-                _eventLoop,
-                std::bind(std::mem_fn(&hw_isolation::record::Manager::
-                                          handleHostIsolatedHardwares),
-                          this),
-                std::chrono::seconds(5)));
-        }
+        if (change._type == diff::ChangeType::Added)
+        {
+            // The entry might be created by the request while the changes
+            // are pending.
+            if (!_isolatedHardwares.contains(change._entryRecordId))
+            {
+                createEntryForRecord(*change._record);
+            }
+            return;
+        }
+
+        auto entryIt = _isolatedHardwares.find(change._entryRecordId);
+        if (entryIt == _isolatedHardwares.end())
+        {
+            return;
+        }
+
+        switch (change._type)
+        {
+            case diff::ChangeType::SeverityChanged:
+                updateEntrySeverity(*change._record, entryIt);
+                break;
+            case diff::ChangeType::ErrorLogChanged:
+                updateEntryErrorLog(*change._record, entryIt);
+                break;
+            default:
+                break;
+        }
     }
     catch (const std::exception& e)
     {
         log<level::ERR>(
-            std::format("Exception [{}], Failed to process "
-                        "hardware isolation record file that's updated",
-                        e.what())
+            std::format("Exception [{}] : Skipping to apply the change "
+                        "[{}] for the entry [{}]",
+                        e.what(), static_cast<int>(change._type),
+                        change._entryRecordId)
                 .c_str());
+
+        // The records were marked as reconciled before applying the changes
+        // so, reconcile again with the next guard file update instead of
+        // ignoring it.
+        openpower_guard::resetReconciledRecords();
     }
 }
 
-void Manager::handleHostIsolatedHardwares()
+void Manager::dropPendingChanges(const entry::EntryRecordId entryRecordId)
+{
+    if (_nextChange >= _changesToApply.size())
+    {
+        return;
+    }
+
+    auto pendingChanges = std::ranges::subrange(
+        _changesToApply.begin() + static_cast<std::ptrdiff_t>(_nextChange),
+        _changesToApply.end());
+    auto staleChanges = std::ranges::remove_if(
+        pendingChanges, [entryRecordId](const auto& change) {
+        return change._entryRecordId == entryRecordId;
+    });
+    _changesToApply.erase(staleChanges.begin(), staleChanges.end());
+}
+
+void Manager::applyPendingChanges()
 {
-    if (!_timerObjs.empty())
+    auto sliceStartTime = std::chrono::steady_clock::now();
+    while (_nextChange < _changesToApply.size())
     {
-        auto timerObj = std::move(_timerObjs.front());
-        _timerObjs.pop();
-        if (timerObj->isEnabled())
+        applyChange(_changesToApply[_nextChange++]);
+
+        if ((std::chrono::steady_clock::now() - sliceStartTime) >=
+            std::chrono::microseconds(RECONCILE_SLICE_BUDGET_US))
         {
-            timerObj->setEnabled(false);
+            break;
         }
     }
 
+    if (_nextChange < _changesToApply.size())
+    {
+        // Continue from the next event loop iteration
+        return;
+    }
+
+    log<level::INFO>(
+        std::format("Applied [{}] host changes on the isolated hardware "
+                    "entries",
+                    _changesToApply.size())
+            .c_str());
+    _changesToApply.clear();
+    _nextChange = 0;
+
+    // The source can't be released from its own callback so,
+    // just disable it.
+    _reconcileSource->set_enabled(sdeventplus::source::Enabled::Off);
+}
+
+void Manager::cleanupPersistedFiles()
+{
+    // The ECO core flags are removed along with the stale entries in
+    // a single pass.
+    _entryLog.retain([this](const auto entryRecordId) {
+        return this->_isolatedHardwares.contains(entryRecordId);
+    });
+}
+
+/**
+ * @brief The number of records to process per event loop iteration while
+ *        restoring incrementally so that, the requests can be served in
+ *        between the restore slices.
+ */
+constexpr size_t RestoreSliceRecords = 8;
+
+void Manager::restore(restore_status::RestoreStatus& restoreStatus)
+{
+    beginRestore(restoreStatus, RestoreMode::Blocking);
+    runRestoreSteps();
+}
+
+void Manager::restoreIncrementally(restore_status::RestoreStatus& restoreStatus,
+                                   RestoredCallback restoredCallback)
+{
+    beginRestore(restoreStatus, RestoreMode::Incremental);
+    _restoreCtx->_restoredCallback = std::move(restoredCallback);
+
+    _restoreSource = std::make_unique<sdeventplus::source::Defer>(
+        _eventLoop, [this](sdeventplus::source::EventBase&) {
+        this->runRestoreSteps();
+    });
+    // Let the requests and signals go first
+    _restoreSource->set_priority(SD_EVENT_PRIORITY_IDLE);
+}
+
+void Manager::beginRestore(restore_status::RestoreStatus& restoreStatus,
+                           RestoreMode mode)
+{
+    _restoreStatus = &restoreStatus;
+    _restoreCtx = std::make_unique<RestoreContext>();
+    _restoreCtx->_mode = mode;
+    _restoreCtx->_startTime = std::chrono::steady_clock::now();
+    _restoreCtx->_stageStartTime = _restoreCtx->_startTime;
+
     // Don't get ephemeral records (GARD_Reconfig and GARD_Sticky_deconfig
     // because those type records are created for internal purpose to use
     // by BMC and Hostboot
-    openpower_guard::GuardRecords records = openpower_guard::getAll(true);
+    _restoreCtx->_records = openpower_guard::getAll(true);
+
+    /**
+     * The restore is done as a pipeline to avoid waiting for the D-Bus
+     * replies per record.
+     *   1 - Resolve the device tree details for all records.
+     *   2 - Resolve the inventory paths by caching the FRU lookups so that,
+     *       the D-Bus lookups depend on the number of FRUs.
+     *   3 - Get the BMC error log paths by keeping all the queries in flight.
+     *   4 - Create the entries and complete them together.
+     *
+     * The records which have the persisted paths from the same device tree
+     * generation skip the steps 2 and 3, and those paths are validated
+     * in the background once restored.
+     */
+    for (const auto& record : _restoreCtx->_records)
+    {
+        if (!isValidRecord(record.recordId))
+        {
+            continue;
+        }
+
+        auto entityPathRawData =
+            devtree::convertEntityPathIntoRawData(record.targetId);
+        std::stringstream ss;
+        std::for_each(entityPathRawData.begin(), entityPathRawData.end(),
+                      [&ss](const auto& ele) {
+            ss << std::setw(2) << std::setfill('0') << std::hex << (int)ele
+               << " ";
+        });
 
-    // Delete all the D-Bus entries if no record in their persisted location
-    if ((records.size() == 0) && _isolatedHardwares.size() > 0)
+        auto entrySeverity = entry::utils::getEntrySeverityType(
+            static_cast<openpower_guard::GardType>(record.errType));
+        if (!entrySeverity.has_value())
+        {
+            log<level::ERR>(
+                std::format("Skipping to restore a given isolated "
+                            "hardware [{}] : Due to failure to to get BMC "
+                            "EntrySeverity by isolated hardware GardType [{}]",
+                            ss.str(), record.errType)
+                    .c_str());
+            continue;
+        }
+
+        bool ecoCore{isPersistedEcoCore(record.recordId, entityPathRawData)};
+        auto& recordToRestore = _restoreCtx->_recordsToRestore.emplace_back(
+            &record, std::move(entityPathRawData), ss.str(), *entrySeverity,
+            ecoCore, sdbusplus::message::object_path());
+
+        auto persistedEntry = _entryLog.getEntries().find(record.recordId);
+        if ((_devTreeGeneration != 0) &&
+            (persistedEntry != _entryLog.getEntries().end()) &&
+            (persistedEntry->second._generation == _devTreeGeneration) &&
+            (persistedEntry->second._entityPath ==
+             recordToRestore._physPath) &&
+            (persistedEntry->second._errLogId == record.elogId) &&
+            !persistedEntry->second._inventoryPath.empty())
+        {
+            recordToRestore._inventoryPath =
+                persistedEntry->second._inventoryPath;
+            recordToRestore._bmcErrorLogPath =
+                persistedEntry->second._bmcErrorLogPath;
+            recordToRestore._persistedPaths = true;
+        }
+    }
+
+    _restoreStatus->totalEntries(_restoreCtx->_recordsToRestore.size());
+    _restoreStatus->restoredEntries(0);
+    _restoreStatus->entries(restore_status::Phase::InProgress);
+
+    _isolatableHWs.enableInventoryLookupCache(true);
+}
+
+void Manager::runRestoreSteps()
+{
+    // The steps are not re-entrant since, those hold the restore context
+    // across the D-Bus calls.
+    if (!_restoreCtx || _runningRestoreSteps)
     {
-        // Clean up all entries association before delete.
-        clearDbusEntries();
-        _isolatedHardwares.clear();
         return;
     }
 
-    auto validRecord = [this](const auto& record) {
-        return this->isValidRecord(record.recordId);
-    };
+    _runningRestoreSteps = true;
+    try
+    {
+        runRestoreSlice();
+    }
+    catch (...)
+    {
+        _runningRestoreSteps = false;
+        throw;
+    }
+    _runningRestoreSteps = false;
+}
 
-    for (auto entryIt = _isolatedHardwares.begin();
-         entryIt != _isolatedHardwares.end();)
+void Manager::runRestoreSlice()
+{
+    // Only the incremental mode runs one slice per event loop iteration.
+    const auto maxRecords = _restoreCtx->_mode == RestoreMode::Incremental
+                                ? RestoreSliceRecords
+                                : _restoreCtx->_recordsToRestore.size();
+    do
     {
-        auto nextEntryIt = std::next(entryIt, 1);
+        switch (_restoreCtx->_stage)
+        {
+            case RestoreContext::Stage::Inventory:
+                restoreInventoryPaths(maxRecords);
+                break;
+            case RestoreContext::Stage::ErrorLog:
+                restoreErrorLogPaths();
+                break;
+            case RestoreContext::Stage::Entry:
+                restoreEntries(maxRecords);
+                break;
+            case RestoreContext::Stage::Completed:
+                completeRestore();
+                return;
+        }
+    } while (_restoreCtx->_mode != RestoreMode::Incremental);
+}
 
-        auto entryRecord = [entryIt](const auto& record) {
-            return entryIt->second->getEntityPath() == record.targetId;
-        };
-        auto entryRecords = records | std::views::filter(entryRecord);
+void Manager::setRestoreStage(RestoreContext::Stage stage)
+{
+    auto stageMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now() -
+                       _restoreCtx->_stageStartTime)
+                       .count();
+    log<level::DEBUG>(std::format("Restore stage [{}] took [{}] ms",
+                                  static_cast<int>(_restoreCtx->_stage),
+                                  stageMs)
+                          .c_str());
+
+    _restoreCtx->_stage = stage;
+    _restoreCtx->_nextRecord = 0;
+    _restoreCtx->_stageStartTime = std::chrono::steady_clock::now();
+}
 
-        if (entryRecords.empty())
+void Manager::restoreInventoryPaths(size_t maxRecords)
+{
+    auto& recordsToRestore = _restoreCtx->_recordsToRestore;
+    auto recordIt = std::next(recordsToRestore.begin(),
+                              static_cast<std::ptrdiff_t>(
+                                  _restoreCtx->_nextRecord));
+    for (size_t processed = 0;
+         (recordIt != recordsToRestore.end()) && (processed < maxRecords);
+         ++processed)
+    {
+        if (recordIt->_persistedPaths)
         {
-            entryIt->second->resolveEntry(false);
+            ++recordIt;
+            continue;
         }
-        else
+
+        std::optional<sdbusplus::message::object_path> inventoryPath;
+        try
         {
-            auto validEntryRecords = entryRecords |
-                                     std::views::filter(validRecord);
+            inventoryPath = _isolatableHWs.getInventoryPath(recordIt->_physPath,
+                                                            recordIt->_ecoCore);
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(std::format("Exception [{}]", e.what()).c_str());
+        }
+
+        if (!inventoryPath.has_value())
+        {
+            log<level::ERR>(
+                std::format(
+                    "Skipping to restore a given isolated "
+                    "hardware [{}] : Due to failure to get inventory path",
+                    recordIt->_physPathStr)
+                    .c_str());
+            addPendingRecord(recordIt->_record->recordId, recordIt->_physPath);
+            recordIt = recordsToRestore.erase(recordIt);
+            continue;
+        }
+        recordIt->_inventoryPath = *inventoryPath;
+
+        _restoreCtx->_pendingEids.emplace(recordIt->_record->elogId);
+        ++recordIt;
+    }
+    _restoreCtx->_nextRecord = static_cast<size_t>(
+        std::distance(recordsToRestore.begin(), recordIt));
+
+    if (recordIt != recordsToRestore.end())
+    {
+        return;
+    }
+
+    _restoreCtx->_numOfFRULookups = _isolatableHWs.getNumOfCachedFRULookups();
+    _isolatableHWs.enableInventoryLookupCache(false);
+    _restoreStatus->totalEntries(recordsToRestore.size());
+    setRestoreStage(RestoreContext::Stage::ErrorLog);
+}
 
-            if (validEntryRecords.empty())
+void Manager::restoreErrorLogPaths()
+{
+    switch (_restoreCtx->_mode)
+    {
+        case RestoreMode::Blocking:
+            _restoreCtx->_bmcErrorLogPaths =
+                utils::getBMCLogPaths(_restoreCtx->_pendingEids);
+            _restoreCtx->_pendingEids.clear();
+            break;
+        case RestoreMode::Incremental:
+            if (_restoreCtx->_pendingEids.empty())
             {
-                entryIt->second->resolveEntry(false);
+                break;
             }
-            else if (std::distance(validEntryRecords.begin(),
-                                   validEntryRecords.end()) == 1)
+            if (!_restoreCtx->_pendingErrorLogCalls.empty())
             {
-                this->updateEntryForRecord(validEntryRecords.front(), entryIt);
+                // Still waiting for the replies
+                return;
             }
-            else
+
+            _restoreCtx->_pendingErrorLogCalls = utils::requestBMCLogPaths(
+                _bus, std::set<uint32_t>(_restoreCtx->_pendingEids),
+                [this](uint32_t eid,
+                       const sdbusplus::message::object_path& bmcLogPath) {
+                this->_restoreCtx->_bmcErrorLogPaths[eid] = bmcLogPath;
+                this->_restoreCtx->_pendingEids.erase(eid);
+                if (this->_restoreCtx->_pendingEids.empty())
+                {
+                    this->_restoreSource->set_enabled(
+                        sdeventplus::source::Enabled::On);
+                }
+            });
+
+            if (!_restoreCtx->_pendingEids.empty())
             {
-                // Should not happen since, more than one valid records
-                // for the same hardware is not allowed
-                auto entityPathRawData = devtree::convertEntityPathIntoRawData(
-                    entryIt->second->getEntityPath());
-                std::stringstream ss;
-                std::for_each(entityPathRawData.begin(),
-                              entityPathRawData.end(), [&ss](const auto& ele) {
-                    ss << std::setw(2) << std::setfill('0') << std::hex
-                       << (int)ele << " ";
-                });
-                log<level::ERR>(std::format("More than one valid records exist "
-                                            "for the same hardware [{}]",
-                                            ss.str())
-                                    .c_str());
+                // The slices are not needed until all the replies are
+                // received
+                _restoreSource->set_enabled(sdeventplus::source::Enabled::Off);
+                return;
             }
+            break;
+        case RestoreMode::Drain:
+            // Don't wait for the replies while serving a request since,
+            // the D-Bus client might time out. The entries are restored
+            // without the remaining paths and, those are added once the
+            // replies are received.
+            _restoreCtx->_pendingErrorLogCalls.clear();
+            _drainedErrorLogCalls = utils::requestBMCLogPaths(
+                _bus, _restoreCtx->_pendingEids,
+                [this](uint32_t eid,
+                       const sdbusplus::message::object_path& bmcLogPath) {
+                this->restoreEntriesErrorLogPath(eid, bmcLogPath);
+            });
+            _restoreCtx->_pendingEids.clear();
+            break;
+    }
+
+    if (!_restoreCtx->_pendingEids.empty())
+    {
+        return;
+    }
+    _restoreCtx->_pendingErrorLogCalls.clear();
+    setRestoreStage(RestoreContext::Stage::Entry);
+}
+
+void Manager::restoreEntries(size_t maxRecords)
+{
+    const auto& recordsToRestore = _restoreCtx->_recordsToRestore;
+    std::vector<entry::EntryRecordId> restoredEntries;
+    auto& nextRecord = _restoreCtx->_nextRecord;
+    for (size_t processed = 0;
+         (nextRecord < recordsToRestore.size()) && (processed < maxRecords);
+         ++processed, ++nextRecord)
+    {
+        const auto& recordToRestore = recordsToRestore[nextRecord];
+        const auto& record = *recordToRestore._record;
+        auto entryPath = createEntry(
+            record.recordId, false, recordToRestore._severity,
+            recordToRestore._inventoryPath.str,
+            recordToRestore._persistedPaths
+                ? recordToRestore._bmcErrorLogPath
+                : _restoreCtx->_bmcErrorLogPaths[record.elogId].str,
+            false, record.targetId, record.elogId, true);
+
+        if (!entryPath.has_value())
+        {
+            log<level::ERR>(
+                std::format(
+                    "Skipping to restore a given isolated "
+                    "hardware [{}] : Due to failure to create dbus entry",
+                    recordToRestore._physPathStr)
+                    .c_str());
+            continue;
         }
-        entryIt = nextEntryIt;
+        _isolatedHardwares.at(record.recordId)
+            ->setEcoCore(recordToRestore._ecoCore);
+        restoredEntries.emplace_back(record.recordId);
+
+        if (recordToRestore._persistedPaths)
+        {
+            _entriesToValidate.emplace_back(record.recordId);
+        }
+    }
+    completeDeferredEntries(restoredEntries);
+
+    _restoreCtx->_numOfRestoredEntries += restoredEntries.size();
+    _restoreStatus->restoredEntries(_restoreCtx->_numOfRestoredEntries);
+
+    if (nextRecord < recordsToRestore.size())
+    {
+        return;
+    }
+    setRestoreStage(RestoreContext::Stage::Completed);
+}
+
+void Manager::completeRestore()
+{
+    openpower_guard::markRecordsReconciled();
+
+    cleanupPersistedFiles();
+
+    log<level::INFO>(
+        std::format("Restored [{}] isolated hardware entries from [{}] "
+                    "records with [{}] FRU lookups and [{}] persisted paths "
+                    "in [{}] ms",
+                    _restoreCtx->_numOfRestoredEntries,
+                    _restoreCtx->_records.size(), _restoreCtx->_numOfFRULookups,
+                    _entriesToValidate.size(),
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() -
+                        _restoreCtx->_startTime)
+                        .count())
+            .c_str());
+
+    _restoreStatus->entries(restore_status::Phase::Completed);
+
+    auto restoredCallback = std::move(_restoreCtx->_restoredCallback);
+    _restoreCtx.reset();
+    if (_restoreSource)
+    {
+        // The source can't be released from its own callback so,
+        // just disable it.
+        _restoreSource->set_enabled(sdeventplus::source::Enabled::Off);
+    }
+
+    if (!_entriesToValidate.empty())
+    {
+        _validateSource = std::make_unique<sdeventplus::source::Defer>(
+            _eventLoop, [this](sdeventplus::source::EventBase&) {
+            this->validatePersistedPaths();
+        });
+        // Let the requests, signals and restore go first
+        _validateSource->set_priority(SD_EVENT_PRIORITY_IDLE);
+    }
+
+    if (restoredCallback)
+    {
+        // The restore might be completed while serving a request so,
+        // the callback is called from its own event loop iteration.
+        _restoredSource = std::make_unique<sdeventplus::source::Defer>(
+            _eventLoop, [restoredCallback = std::move(restoredCallback)](
+                            sdeventplus::source::EventBase& source) {
+            source.set_enabled(sdeventplus::source::Enabled::Off);
+            restoredCallback();
+        });
+    }
+}
+
+void Manager::drainRestore()
+{
+    if (!_restoreCtx)
+    {
+        return;
     }
 
-    auto validRecords = records | std::views::filter(validRecord);
+    if (_runningRestoreSteps)
+    {
+        // The request is dispatched from the restore steps, the restore
+        // will be completed once the steps are resumed.
+        log<level::DEBUG>("Serving the request in the middle of the restore");
+        return;
+    }
 
-    auto createEntryIfNotExists = [this](const auto& validRecord) {
-        auto recordExist = [validRecord](const auto& entry) {
-            return validRecord.targetId == entry.second->getEntityPath();
-        };
+    log<level::INFO>("Completing the in progress restore to serve the request");
+    _restoreCtx->_mode = RestoreMode::Drain;
+    runRestoreSteps();
+}
 
-        if (std::ranges::none_of(this->_isolatedHardwares, recordExist))
+void Manager::restoreEntriesErrorLogPath(
+    uint32_t eid, const sdbusplus::message::object_path& bmcLogPath)
+{
+    if ((eid == 0) || bmcLogPath.str.empty())
+    {
+        return;
+    }
+
+    for (auto& [entryRecordId, entry] : _isolatedHardwares)
+    {
+        if ((entry->getEntryErrLogId() != eid) ||
+            !entry->getBmcErrorLogPath().empty())
         {
-            this->createEntryForRecord(validRecord);
+            continue;
         }
-    };
 
-    std::ranges::for_each(validRecords, createEntryIfNotExists);
+        auto associations = entry->associations();
+        associations.push_back(std::make_tuple(
+            "isolated_hw_errorlog", "isolated_hw_entry", bmcLogPath.str));
+        entry->associations(associations);
+        entry->serialize();
+    }
+}
 
-    cleanupPersistedEcoCores();
+void Manager::validatePersistedPaths()
+{
+    for (size_t processed = 0;
+         !_entriesToValidate.empty() && (processed < RestoreSliceRecords);
+         ++processed)
+    {
+        validateEntryPaths(_entriesToValidate.back());
+        _entriesToValidate.pop_back();
+    }
+
+    if (_entriesToValidate.empty())
+    {
+        log<level::INFO>("Validated the persisted paths of the restored "
+                         "isolated hardware entries");
+        // The source can't be released from its own callback so,
+        // just disable it.
+        _validateSource->set_enabled(sdeventplus::source::Enabled::Off);
+    }
+}
+
+void Manager::validateEntryPaths(const entry::EntryRecordId entryRecordId)
+{
+    auto entryIt = _isolatedHardwares.find(entryRecordId);
+    if (entryIt == _isolatedHardwares.end())
+    {
+        // The entry is removed after restored
+        return;
+    }
+
+    std::optional<sdbusplus::message::object_path> inventoryPath;
+    bool ecoCore{entryIt->second->isEcoCore()};
+    try
+    {
+        inventoryPath = _isolatableHWs.getInventoryPath(
+            devtree::convertEntityPathIntoRawData(
+                entryIt->second->getEntityPath()),
+            ecoCore);
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(std::format("Exception [{}]", e.what()).c_str());
+    }
+
+    if (!inventoryPath.has_value())
+    {
+        log<level::ERR>(
+            std::format("Keeping the persisted paths of the entry [{}] : "
+                        "Due to failure to get inventory path",
+                        entryRecordId)
+                .c_str());
+        return;
+    }
+    entryIt->second->setEcoCore(ecoCore);
+
+    std::string persistedInventoryPath;
+    std::string bmcErrorLogPath;
+    for (const auto& [fwdType, revType, objPath] :
+         entryIt->second->associations())
+    {
+        if (fwdType == "isolated_hw")
+        {
+            persistedInventoryPath = objPath;
+        }
+        else if (fwdType == "isolated_hw_errorlog")
+        {
+            bmcErrorLogPath = objPath;
+        }
+    }
+
+    // Keep the persisted error log path if failed to get
+    if (auto errorLogPath =
+            utils::getBMCLogPath(_bus, entryIt->second->getEntryErrLogId());
+        errorLogPath.has_value())
+    {
+        bmcErrorLogPath = errorLogPath->str;
+    }
+
+    type::AssociationDef associationDeftoHw;
+    associationDeftoHw.push_back(std::make_tuple(
+        "isolated_hw", "isolated_hw_entry", inventoryPath->str));
+    if (!bmcErrorLogPath.empty())
+    {
+        associationDeftoHw.push_back(std::make_tuple(
+            "isolated_hw_errorlog", "isolated_hw_entry", bmcErrorLogPath));
+    }
+
+    if (entryIt->second->associations() == associationDeftoHw)
+    {
+        return;
+    }
+
+    log<level::INFO>(
+        std::format("The persisted paths of the entry [{}] are changed, "
+                    "updating the inventory path [{}] and the error log "
+                    "path [{}]",
+                    entryRecordId, inventoryPath->str, bmcErrorLogPath)
+            .c_str());
+
+    unindexEntry(entryRecordId, persistedInventoryPath);
+    entryIt->second->associations(associationDeftoHw);
+    indexEntry(entryRecordId, inventoryPath->str);
+    if (persistedInventoryPath != inventoryPath->str)
+    {
+        // The old hardware might be isolated by another entry
+        if (!_entriesByInvPath.contains(persistedInventoryPath))
+        {
+            utils::setEnabledProperty(_bus, persistedInventoryPath, true);
+        }
+        utils::setEnabledProperty(_bus, inventoryPath->str,
+                                  entryIt->second->resolved());
+    }
+    entryIt->second->serialize();
+}
+
+void Manager::processHardwareIsolationRecordFile()
+{
+    /**
+     * Debounce the guard file updates to get the final isolated hardware
+     * record list which are updated by the host because of the atomicity
+     * on the partition file (which is used to store isolated hardware details)
+     * between BMC and Host.
+     *
+     * The host updates the partition file in bursts (for example, during
+     * IPL) so, all the updates within the quiet period are processed
+     * together but, not later than the maximum latency from the first
+     * update to avoid delaying the isolated hardware entries.
+     */
+    try
+    {
+        // The own writes are checked once the updates are debounced
+        // to avoid reading the guard file for every update.
+        _guardFileDebounce.trigger();
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(
+            std::format("Exception [{}], Failed to process "
+                        "hardware isolation record file that's updated",
+                        e.what())
+                .c_str());
+    }
+}
+
+void Manager::handleGuardFileUpdates()
+{
+    // Log the debounce counters per burst to tune the quiet period and
+    // the maximum latency based on the host update pattern.
+    const auto& stats = _guardFileDebounce.getStats();
+    log<level::INFO>(
+        std::format("Debounced [{}] guard file updates (max [{}], total "
+                    "updates [{}], total bursts [{}], max latency bursts [{}])",
+                    stats._lastCoalesced, stats._maxCoalesced,
+                    stats._totalTriggers, stats._totalFlushes,
+                    stats._maxLatencyFlushes)
+            .c_str());
+
+    // Ignore the updates if the guard file is updated only by this daemon
+    // since the last reconciliation because, those updates are already
+    // applied on the entries.
+    if (openpower_guard::isReconciled())
+    {
+        return;
+    }
+
+    handleHostIsolatedHardwares();
+}
+
+void Manager::handleHostIsolatedHardwares()
+{
+    // The records are restored from the latest file so, the host changes
+    // are reflected once the restore is completed.
+    drainRestore();
+
+    // Don't get ephemeral records (GARD_Reconfig and GARD_Sticky_deconfig
+    // because those type records are created for internal purpose to use
+    // by BMC and Hostboot
+    openpower_guard::GuardRecords records = openpower_guard::getAll(true);
+    prunePendingRecords(records);
+
+    // Apply only the differences between the existing D-Bus entries and
+    // the records so, unchanged entries and their persisted files won't
+    // be touched.
+    auto changeSet = diff::computeChangeSet(
+        diff::getEntryStates(_isolatedHardwares), records);
+
+    // Mark before applying so that, the own guard record updates while
+    // applying the changes are tracked on top of the reconciled records.
+    // The mark is dropped if any change is failed to apply.
+    openpower_guard::markRecordsReconciled();
+
+    applyChangeSet(std::move(changeSet));
+}
+
+void Manager::addPendingRecord(
+    const entry::EntryRecordId recordId,
+    const devtree::DevTreePhysPath& entityPathRawData)
+{
+    if (!isValidRecord(recordId))
+    {
+        return;
+    }
+
+    auto locCode =
+        _isolatableHWs.getFRULocationCode(entityPathRawData).value_or("");
+    log<level::INFO>(
+        std::format("Keeping the isolated hardware record [{}] as pending "
+                    "until the inventory of the FRU [{}] is added",
+                    recordId, locCode)
+            .c_str());
+    _pendingRecords.insert_or_assign(recordId, std::move(locCode));
+
+    if (_restoreStatus != nullptr)
+    {
+        _restoreStatus->pendingEntries(_pendingRecords.size());
+    }
+
+    if (_inventoryAddedWatcher)
+    {
+        return;
+    }
+
+    try
+    {
+        namespace sdbusplus_match = sdbusplus::bus::match;
+
+        // Watch the inventory which is added after restored to create
+        // the entries for the pending records
+        _inventoryAddedWatcher = std::make_unique<sdbusplus_match::match>(
+            _bus,
+            sdbusplus_match::rules::interfacesAdded(
+                "/xyz/openbmc_project/inventory"),
+            std::bind(std::mem_fn(&Manager::onInventoryAdded), this,
+                      std::placeholders::_1));
+    }
+    catch (const std::exception& e)
+    {
+        log<level::ERR>(
+            std::format("Exception [{}] while adding the D-Bus match rule "
+                        "to retry the pending records",
+                        e.what())
+                .c_str());
+    }
+}
+
+void Manager::removePendingRecord(const entry::EntryRecordId recordId)
+{
+    if ((_pendingRecords.erase(recordId) != 0) && (_restoreStatus != nullptr))
+    {
+        _restoreStatus->pendingEntries(_pendingRecords.size());
+    }
+}
+
+void Manager::prunePendingRecords(const openpower_guard::GuardRecords& records)
+{
+    auto numOfPruned =
+        std::erase_if(_pendingRecords, [&records](const auto& pendingRecord) {
+        return std::ranges::none_of(records,
+                                    [&pendingRecord](const auto& record) {
+            return record.recordId == pendingRecord.first;
+        });
+    });
+
+    if ((numOfPruned != 0) && (_restoreStatus != nullptr))
+    {
+        _restoreStatus->pendingEntries(_pendingRecords.size());
+    }
+}
+
+void Manager::onInventoryAdded(sdbusplus::message::message& message)
+{
+    if (_pendingRecords.empty())
+    {
+        return;
+    }
+
+    sdbusplus::message::object_path inventoryPath;
+    type::InventoryInterfaces interfaces;
+    try
+    {
+        message.read(inventoryPath, interfaces);
+    }
+    catch (const sdbusplus::exception::exception& e)
+    {
+        log<level::ERR>(
+            std::format("Exception [{}] while reading the InterfacesAdded "
+                        "signal to retry the pending records",
+                        e.what())
+                .c_str());
+        return;
+    }
+
+    auto locCodeIfaceIt =
+        interfaces.find("xyz.openbmc_project.Inventory.Decorator.LocationCode");
+    if (locCodeIfaceIt == interfaces.end())
+    {
+        return;
+    }
+
+    auto locCodePropIt = locCodeIfaceIt->second.find("LocationCode");
+    if ((locCodePropIt == locCodeIfaceIt->second.end()) ||
+        !std::holds_alternative<std::string>(locCodePropIt->second))
+    {
+        return;
+    }
+
+    auto unExpandedLocCode = devtree::getUnexpandedLocCode(
+        std::get<std::string>(locCodePropIt->second));
+    if (!unExpandedLocCode.has_value())
+    {
+        return;
+    }
+
+    // The records which are failed to get the FRU location code are
+    // retried for all the added inventory.
+    std::set<entry::EntryRecordId> recordsToRetry;
+    for (const auto& [recordId, locCode] : _pendingRecords)
+    {
+        if (locCode.empty() || (locCode == *unExpandedLocCode))
+        {
+            recordsToRetry.emplace(recordId);
+        }
+    }
+
+    if (recordsToRetry.empty())
+    {
+        return;
+    }
+
+    log<level::INFO>(
+        std::format("Retrying [{}] pending isolated hardware records since "
+                    "the inventory [{}] is added",
+                    recordsToRetry.size(), inventoryPath.str)
+            .c_str());
+
+    // Don't get ephemeral records (GARD_Reconfig and GARD_Sticky_deconfig
+    // because those type records are created for internal purpose to use
+    // by BMC and Hostboot
+    auto records = openpower_guard::getAll(true);
+    prunePendingRecords(records);
+    for (const auto& record : records)
+    {
+        if (!recordsToRetry.contains(record.recordId) ||
+            !_pendingRecords.contains(record.recordId) ||
+            _isolatedHardwares.contains(record.recordId))
+        {
+            continue;
+        }
+
+        // The record will be kept as pending again if the inventory
+        // is still not available.
+        createEntryForRecord(record, true);
+    }
+}
+
+void Manager::indexEntry(const entry::EntryRecordId entryRecordId,
+                         const std::string& isolatedHardware)
+{
+    _entriesByInvPath[isolatedHardware].emplace(entryRecordId);
+    _entriesFRULocCode.erase(entryRecordId);
+}
+
+void Manager::unindexEntry(const entry::EntryRecordId entryRecordId,
+                           const std::string& isolatedHardware)
+{
+    _entriesFRULocCode.erase(entryRecordId);
+
+    auto indexIt = _entriesByInvPath.find(isolatedHardware);
+    if (indexIt == _entriesByInvPath.end())
+    {
+        return;
+    }
+
+    indexIt->second.erase(entryRecordId);
+    if (indexIt->second.empty())
+    {
+        _entriesByInvPath.erase(indexIt);
+    }
+}
+
+const type::LocationCode&
+    Manager::getEntryFRULocCode(const entry::EntryRecordId entryRecordId,
+                                const entry::Entry& entry)
+{
+    auto locCodeIt = _entriesFRULocCode.find(entryRecordId);
+    if (locCodeIt == _entriesFRULocCode.end())
+    {
+        auto locCode =
+            _isolatableHWs
+                .getFRULocationCode(devtree::convertEntityPathIntoRawData(
+                    entry.getEntityPath()))
+                .value_or("");
+        locCodeIt =
+            _entriesFRULocCode.emplace(entryRecordId, std::move(locCode)).first;
+    }
+    return locCodeIt->second;
+}
+
+EntryQueryResult
+    Manager::getEntryQueryResult(const entry::EntryRecordId entryRecordId,
+                                 const entry::Entry& entry) const
+{
+    auto bmcErrorLogPath = entry.getBmcErrorLogPath();
+    return {(fs::path(HW_ISOLATION_ENTRY_OBJPATH) /
+             std::to_string(entryRecordId))
+                .string(),
+            entry.severity(),
+            entry.resolved(),
+            entry.elapsed(),
+            entry.getIsolatedHwInvPath(),
+            bmcErrorLogPath.empty() ? "/" : bmcErrorLogPath};
+}
+
+std::vector<EntryQueryResult> Manager::getEntries(
+    std::vector<entry::EntrySeverity> severities,
+    EntryQueryInterface::ResolvedFilter resolved,
+    sdbusplus::message::object_path inventoryPath, std::string locationCode,
+    EntryQueryInterface::ErrorLogFilter errorLog, uint64_t startTime,
+    uint64_t endTime)
+{
+    // The FRU location code is kept in the unexpanded format
+    // in the device tree.
+    std::optional<type::LocationCode> fruLocCode;
+    if (!locationCode.empty())
+    {
+        fruLocCode = locationCode.starts_with("Ufcs")
+                         ? std::make_optional(locationCode)
+                         : devtree::getUnexpandedLocCode(locationCode);
+        if (!fruLocCode.has_value())
+        {
+            log<level::ERR>(std::format("Invalid argument [LocationCode: {}]",
+                                        locationCode)
+                                .c_str());
+            throw type::CommonError::InvalidArgument();
+        }
+    }
+
+    if ((endTime != 0) && (startTime > endTime))
+    {
+        log<level::ERR>(std::format("Invalid argument [StartTime: {}, "
+                                    "EndTime: {}]",
+                                    startTime, endTime)
+                            .c_str());
+        throw type::CommonError::InvalidArgument();
+    }
+
+    // Use the inventory path index to get the candidates instead of
+    // walking all the entries if the hardware is given.
+    std::vector<entry::EntryRecordId> entryRecordIds;
+    if (inventoryPath.str == "/")
+    {
+        entryRecordIds.reserve(_isolatedHardwares.size());
+        for (const auto& [entryRecordId, entry] : _isolatedHardwares)
+        {
+            entryRecordIds.emplace_back(entryRecordId);
+        }
+    }
+    else
+    {
+        const auto childPathPrefix = inventoryPath.str + "/";
+        for (const auto& [isolatedHardware, ids] : _entriesByInvPath)
+        {
+            if ((isolatedHardware == inventoryPath.str) ||
+                isolatedHardware.starts_with(childPathPrefix))
+            {
+                entryRecordIds.insert(entryRecordIds.end(), ids.begin(),
+                                      ids.end());
+            }
+        }
+        std::ranges::sort(entryRecordIds);
+    }
+
+    std::vector<EntryQueryResult> entries;
+    for (const auto& entryRecordId : entryRecordIds)
+    {
+        const auto& entry = *_isolatedHardwares.at(entryRecordId);
+
+        if ((!severities.empty() &&
+             (std::ranges::find(severities, entry.severity()) ==
+              severities.end())) ||
+            ((resolved == EntryQueryInterface::ResolvedFilter::Resolved) &&
+             !entry.resolved()) ||
+            ((resolved == EntryQueryInterface::ResolvedFilter::Unresolved) &&
+             entry.resolved()) ||
+            ((errorLog == EntryQueryInterface::ErrorLogFilter::Present) &&
+             entry.getBmcErrorLogPath().empty()) ||
+            ((errorLog == EntryQueryInterface::ErrorLogFilter::Absent) &&
+             !entry.getBmcErrorLogPath().empty()) ||
+            (entry.elapsed() < startTime) ||
+            ((endTime != 0) && (entry.elapsed() > endTime)))
+        {
+            continue;
+        }
+
+        // Check the location code at the end since, it might require
+        // the device tree lookup for the first time.
+        if (fruLocCode.has_value() &&
+            (getEntryFRULocCode(entryRecordId, entry) != *fruLocCode))
+        {
+            continue;
+        }
+
+        entries.emplace_back(getEntryQueryResult(entryRecordId, entry));
+    }
+    return entries;
+}
+
+std::vector<EntryQueryResult>
+    Manager::getHardwareEntries(sdbusplus::message::object_path hardware)
+{
+    std::vector<EntryQueryResult> entries;
+
+    auto indexIt = _entriesByInvPath.find(hardware.str);
+    if (indexIt == _entriesByInvPath.end())
+    {
+        return entries;
+    }
+
+    for (const auto& entryRecordId : indexIt->second)
+    {
+        entries.emplace_back(getEntryQueryResult(
+            entryRecordId, *_isolatedHardwares.at(entryRecordId)));
+    }
+    return entries;
+}
+
+/**
+ * @brief Helper function to get the precedence of the given severity,
+ *        the lower value is the higher precedence.
+ */
+static size_t getSeverityPrecedence(const entry::EntrySeverity& severity)
+{
+    constexpr std::array severityPrecedence = {
+        entry::EntrySeverity::Spare, entry::EntrySeverity::Critical,
+        entry::EntrySeverity::Warning, entry::EntrySeverity::Manual};
+
+    return static_cast<size_t>(std::distance(
+        severityPrecedence.begin(),
+        std::ranges::find(severityPrecedence, severity)));
+}
+
+std::optional<sdbusplus::message::object_path>
+    Manager::getIsolatedEntry(const std::string& isolatedHardware,
+                              const entry::EntrySeverity& severity,
+                              const std::string& bmcErrorLog)
+{
+    // The entries might not reflect the host updates which are
+    // yet to process or apply.
+    if (_guardFileDebounce.isPending() || !_changesToApply.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto indexIt = _entriesByInvPath.find(isolatedHardware);
+    if (indexIt == _entriesByInvPath.end())
+    {
+        return std::nullopt;
+    }
+
+    for (const auto& entryRecordId : indexIt->second)
+    {
+        const auto& entry = _isolatedHardwares.at(entryRecordId);
+        if (!entry->resolved() &&
+            (getSeverityPrecedence(entry->severity()) <=
+             getSeverityPrecedence(severity)) &&
+            (entry->getBmcErrorLogPath() == bmcErrorLog))
+        {
+            log<level::INFO>(
+                std::format("The given hardware [{}] is already isolated by "
+                            "the entry [{}]",
+                            isolatedHardware, entryRecordId)
+                    .c_str());
+            return sdbusplus::message::object_path(
+                (fs::path(HW_ISOLATION_ENTRY_OBJPATH) /
+                 std::to_string(entryRecordId))
+                    .string());
+        }
+    }
+    return std::nullopt;
 }
 
 std::optional<std::tuple<entry::EntrySeverity, entry::EntryErrLogPath>>
     Manager::getIsolatedHwRecordInfo(
         const sdbusplus::message::object_path& hwInventoryPath)
 {
+    drainRestore();
+
     // If there is more than one hw isolation entry matching the inventory
     // The possibility of that is very less as we do not intend to create
     // more than 1 record per physical dimm.
     std::vector<hw_isolation::record::IsolatedHardwares::iterator>
         entriesIterators;
 
-    // Make sure whether the given hardware inventory is exists
-    // in the record list.
-    for (auto it = _isolatedHardwares.begin(); it != _isolatedHardwares.end();
-         ++it)
-    {
-        if ([&it, hwInventoryPath]() {
-            for (const auto& assocEle : it->second->associations())
-            {
-                if (std::get<0>(assocEle) == "isolated_hw")
-                {
-                    return std::get<2>(assocEle) == hwInventoryPath.str;
-                }
-            }
-            return false;
-        }())
-        {
-            // Get all the HW Isolation entries that match the inventory path
-            // For Dimms, there could be more than one entry
-            entriesIterators.push_back(it);
-        }
-    }
+    // Get all the HW Isolation entries that match the inventory path
+    // from the index. For Dimms, there could be more than one entry
+    auto indexIt = _entriesByInvPath.find(hwInventoryPath.str);
     // inventory path  not found
-    if (entriesIterators.size() == 0)
+    if (indexIt == _entriesByInvPath.end())
     {
         return std::nullopt;
     }
 
+    for (const auto& entryRecordId : indexIt->second)
+    {
+        entriesIterators.push_back(_isolatedHardwares.find(entryRecordId));
+    }
+
     std::vector<entry::EntryErrLogPath> errLogPathList;
     std::vector<entry::EntrySeverity> severityList;
 
@@ -9,7 +9,11 @@
 #include <xyz/openbmc_project/Common/File/error.hpp>
 #include <xyz/openbmc_project/HardwareIsolation/error.hpp>
 
+#include <algorithm>
+#include <array>
 #include <format>
+#include <fstream>
+#include <map>
 
 namespace hw_isolation
 {
@@ -61,35 +65,348 @@ namespace HardwareIsolationError =
         throw type::CommonError::TooManyResources();                           \
     }
 
+/**
+ * @brief Used to hold the last parsed guard records along with the guard
+ *        file fingerprint which is not changed while parsing.
+ */
+struct ParsedGuardRecords
+{
+    GuardFileFingerprint _fingerprint;
+    GuardRecords _records;
+};
+
+/**
+ * @brief The parsed guard records cache per persistentTypeOnly value
+ */
+static std::map<bool, ParsedGuardRecords> parsedGuardRecordsCache;
+
+/**
+ * @brief Used to hold the valid guard records by their record id along with
+ *        the persistentTypeOnly value which is used to read them.
+ */
+struct ReadGuardRecords
+{
+    bool _persistentTypeOnly;
+    std::map<uint32_t, GuardRecord> _records;
+};
+
+/**
+ * @brief The valid guard records of the last read
+ */
+static std::optional<ReadGuardRecords> lastReadRecords;
+
+/**
+ * @brief The valid guard records which are reflected by the isolated
+ *        hardware entries including the own writes.
+ */
+static std::optional<ReadGuardRecords> reconciledRecords;
+
+/**
+ * @brief Helper API to get the valid guard records by their record id
+ *
+ * @param[in] records - the guard records to look
+ * @param[in] persistentTypeOnly - the value which is used to read the records
+ *
+ * @return The valid guard records
+ */
+static ReadGuardRecords getValidRecords(const GuardRecords& records,
+                                        bool persistentTypeOnly)
+{
+    ReadGuardRecords validRecords{persistentTypeOnly, {}};
+    for (const auto& record : records)
+    {
+        if (isValidRecord(record.recordId))
+        {
+            validRecords._records.insert_or_assign(record.recordId, record);
+        }
+    }
+    return validRecords;
+}
+
+/**
+ * @brief Helper API to track the own created record on top of
+ *        the reconciled records.
+ *
+ * @param[in] record - the created record
+ *
+ * @return NULL
+ *
+ * @note The reconciled records are updated as per the own write instead of
+ *       reading the guard file so that, someone else updates in between are
+ *       not considered as reconciled.
+ */
+static void trackOwnCreate(const GuardRecord& record)
+{
+    if (!reconciledRecords.has_value())
+    {
+        return;
+    }
+
+    // The ephemeral records are not read if persistentTypeOnly is used
+    if (reconciledRecords->_persistentTypeOnly &&
+        ((record.errType == GardType::GARD_Reconfig) ||
+         (record.errType == GardType::GARD_Sticky_deconfig)))
+    {
+        return;
+    }
+
+    reconciledRecords->_records.insert_or_assign(record.recordId, record);
+}
+
+/**
+ * @brief Helper API to track the own cleared record on top of
+ *        the reconciled records.
+ *
+ * @param[in] recordId - the cleared record id, empty if all records are
+ *                       cleared
+ *
+ * @return NULL
+ */
+static void trackOwnClear(const std::optional<uint32_t>& recordId)
+{
+    if (!reconciledRecords.has_value())
+    {
+        return;
+    }
+
+    if (recordId.has_value())
+    {
+        reconciledRecords->_records.erase(*recordId);
+    }
+    else
+    {
+        reconciledRecords->_records.clear();
+    }
+}
+
 std::optional<GuardRecord> create(const EntityPath& entityPath,
                                   const uint32_t errorLogId,
                                   const GardType guardType)
 {
-    CALL_LIBGUARD_INTERFACE(
-        return libguard::create(entityPath, errorLogId, guardType);)
+    std::optional<GuardRecord> record;
+
+    try
+    {
+        CALL_LIBGUARD_INTERFACE(
+            record = libguard::create(entityPath, errorLogId, guardType);)
+    }
+    catch (...)
+    {
+        // The guard file might be updated partially
+        reconciledRecords.reset();
+        throw;
+    }
+
+    if (record.has_value())
+    {
+        trackOwnCreate(*record);
+    }
+
+    return record;
+}
+
+std::vector<CreatedGuardRecord>
+    createBatch(const std::vector<GuardRecordToCreate>& recordsToCreate)
+{
+    std::vector<CreatedGuardRecord> createdRecords;
+    createdRecords.reserve(recordsToCreate.size());
+
+    // The libguard validates and writes one record per call and, its file
+    // layout is private so, the batch saves only the per request overhead.
+    for (const auto& [entityPath, errorLogId, guardType] : recordsToCreate)
+    {
+        try
+        {
+            CALL_LIBGUARD_INTERFACE(createdRecords.emplace_back(
+                libguard::create(entityPath, errorLogId, guardType));)
+            trackOwnCreate(std::get<GuardRecord>(createdRecords.back()));
+        }
+        catch (const sdbusplus::exception::exception& e)
+        {
+            reconciledRecords.reset();
+            createdRecords.emplace_back(std::string(e.name()));
+        }
+        catch (const std::exception& e)
+        {
+            log<level::ERR>(
+                std::format("Exception [{}] while creating the guard record",
+                            e.what())
+                    .c_str());
+            reconciledRecords.reset();
+            createdRecords.emplace_back(
+                std::string(type::CommonError::InternalFailure().name()));
+        }
+    }
 
-    return std::nullopt;
+    return createdRecords;
 }
 
 void clear(const uint32_t recordId)
 {
-    CALL_LIBGUARD_INTERFACE(libguard::clear(recordId);)
+    try
+    {
+        CALL_LIBGUARD_INTERFACE(libguard::clear(recordId);)
+    }
+    catch (...)
+    {
+        reconciledRecords.reset();
+        throw;
+    }
+
+    trackOwnClear(recordId);
 }
 
 void clearAll()
 {
-    CALL_LIBGUARD_INTERFACE(libguard::invalidateAll();)
+    try
+    {
+        CALL_LIBGUARD_INTERFACE(libguard::invalidateAll();)
+    }
+    catch (...)
+    {
+        reconciledRecords.reset();
+        throw;
+    }
+
+    trackOwnClear(std::nullopt);
 }
 
-GuardRecords getAll(bool persistentTypeOnly)
+/**
+ * @brief Helper API to get the guard records by using the cache
+ *
+ * @param[in] persistentTypeOnly - Used to decide whether wants to get all
+ *                                 records or only persistent type records.
+ *
+ * @return The all guard records on success
+ *         Throw exception on failure
+ */
+static GuardRecords readRecords(bool persistentTypeOnly)
 {
+    auto fingerprint = getGuardFileFingerprint();
+    if (fingerprint.has_value())
+    {
+        auto cacheIt = parsedGuardRecordsCache.find(persistentTypeOnly);
+        if ((cacheIt != parsedGuardRecordsCache.end()) &&
+            (cacheIt->second._fingerprint == *fingerprint))
+        {
+            return cacheIt->second._records;
+        }
+    }
+
     GuardRecords records;
 
     CALL_LIBGUARD_INTERFACE(records = libguard::getAll(persistentTypeOnly);)
 
+    // Cache only if the guard file is not updated while parsing since,
+    // the parsed records might be from either content.
+    if (fingerprint.has_value() && (getGuardFileFingerprint() == fingerprint))
+    {
+        parsedGuardRecordsCache.insert_or_assign(
+            persistentTypeOnly, ParsedGuardRecords{*fingerprint, records});
+    }
+    else
+    {
+        parsedGuardRecordsCache.erase(persistentTypeOnly);
+    }
+
+    return records;
+}
+
+GuardRecords getAll(bool persistentTypeOnly)
+{
+    auto records = readRecords(persistentTypeOnly);
+    lastReadRecords = getValidRecords(records, persistentTypeOnly);
     return records;
 }
 
+std::optional<GuardFileFingerprint> getGuardFileFingerprint()
+{
+    std::ifstream guardFile;
+    try
+    {
+        guardFile.open(getGuardFilePath(), std::ios::binary);
+    }
+    catch (const std::exception& e)
+    {
+        return std::nullopt;
+    }
+
+    if (!guardFile.is_open())
+    {
+        return std::nullopt;
+    }
+
+    // FNV-1a 64 bit hash
+    constexpr uint64_t fnvOffsetBasis = 0xcbf29ce484222325;
+    constexpr uint64_t fnvPrime = 0x100000001b3;
+
+    GuardFileFingerprint fingerprint{0, fnvOffsetBasis};
+    std::array<char, 4096> buffer;
+    while (guardFile)
+    {
+        guardFile.read(buffer.data(), buffer.size());
+        auto readBytes = guardFile.gcount();
+        for (std::streamsize i = 0; i < readBytes; ++i)
+        {
+            fingerprint._hash ^= static_cast<uint8_t>(buffer[i]);
+            fingerprint._hash *= fnvPrime;
+        }
+        fingerprint._size += static_cast<uintmax_t>(readBytes);
+    }
+
+    if (guardFile.bad())
+    {
+        return std::nullopt;
+    }
+
+    return fingerprint;
+}
+
+void markRecordsReconciled()
+{
+    reconciledRecords = lastReadRecords;
+}
+
+void resetReconciledRecords()
+{
+    reconciledRecords.reset();
+}
+
+bool isReconciled()
+{
+    if (!reconciledRecords.has_value())
+    {
+        return false;
+    }
+
+    ReadGuardRecords currentRecords;
+    try
+    {
+        currentRecords = getValidRecords(
+            readRecords(reconciledRecords->_persistentTypeOnly),
+            reconciledRecords->_persistentTypeOnly);
+    }
+    catch (const std::exception& e)
+    {
+        // Let the caller to read the guard records again
+        return false;
+    }
+
+    return std::ranges::equal(
+        currentRecords._records, reconciledRecords->_records,
+        [](const auto& lhs, const auto& rhs) {
+        return (lhs.second.recordId == rhs.second.recordId) &&
+               (lhs.second.targetId == rhs.second.targetId) &&
+               (lhs.second.elogId == rhs.second.elogId) &&
+               (lhs.second.errType == rhs.second.errType);
+    });
+}
+
+bool isValidRecord(const uint32_t recordId)
+{
+    return recordId != 0xFFFFFFFF;
+}
+
 const fs::path getGuardFilePath()
 {
     fs::path guardfilePath;
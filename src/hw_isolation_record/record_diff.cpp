@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hw_isolation_record/record_diff.hpp"
+
+#include "hw_isolation_record/manager.hpp"
+
+#include <phosphor-logging/elog-errors.hpp>
+
+#include <algorithm>
+#include <format>
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+
+namespace hw_isolation
+{
+namespace record
+{
+namespace diff
+{
+
+using namespace phosphor::logging;
+
+EntryStates getEntryStates(const IsolatedHardwares& isolatedHardwares)
+{
+    EntryStates entryStates;
+    entryStates.reserve(isolatedHardwares.size());
+    for (const auto& [entryRecordId, entry] : isolatedHardwares)
+    {
+        entryStates.emplace_back(
+            entryRecordId,
+            devtree::convertEntityPathIntoRawData(entry->getEntityPath()),
+            entry->severity(), entry->getEntryErrLogId());
+    }
+    return entryStates;
+}
+
+ChangeSet computeChangeSet(const EntryStates& entryStates,
+                           const openpower_guard::GuardRecords& records)
+{
+    // Keyed view of the valid records by using the entity path raw data.
+    std::map<devtree::DevTreePhysPath,
+             std::vector<const openpower_guard::GuardRecord*>>
+        validRecords;
+    for (const auto& record : records)
+    {
+        if (!Manager::isValidRecord(record.recordId))
+        {
+            continue;
+        }
+        validRecords[devtree::convertEntityPathIntoRawData(record.targetId)]
+            .push_back(&record);
+    }
+
+    ChangeSet removed;
+    ChangeSet updated;
+    ChangeSet added;
+
+    std::set<devtree::DevTreePhysPath> entriesEntityPath;
+    for (const auto& [entryRecordId, entityPathRawData, entrySeverity,
+                      entryErrLogId] : entryStates)
+    {
+        entriesEntityPath.emplace(entityPathRawData);
+
+        auto recordIt = validRecords.find(entityPathRawData);
+        if (recordIt == validRecords.end())
+        {
+            removed.push_back({ChangeType::Removed, entryRecordId, {}});
+            continue;
+        }
+
+        if (recordIt->second.size() > 1)
+        {
+            // Should not happen since, more than one valid records
+            // for the same hardware is not allowed
+            std::stringstream ss;
+            std::for_each(entityPathRawData.begin(), entityPathRawData.end(),
+                          [&ss](const auto& ele) {
+                ss << std::setw(2) << std::setfill('0') << std::hex << (int)ele
+                   << " ";
+            });
+            log<level::ERR>(std::format("More than one valid records exist "
+                                        "for the same hardware [{}]",
+                                        ss.str())
+                                .c_str());
+            continue;
+        }
+
+        const auto& record = *(recordIt->second.front());
+        if (record.recordId != entryRecordId)
+        {
+            // The record is recreated for the same hardware so,
+            // the entry needs to replace since the entry object path
+            // and its persisted file are based on the record id.
+            removed.push_back({ChangeType::Removed, entryRecordId, {}});
+            added.push_back({ChangeType::Added, record.recordId, record});
+            continue;
+        }
+
+        auto recordSeverity = entry::utils::getEntrySeverityType(
+            static_cast<openpower_guard::GardType>(record.errType));
+        if (recordSeverity.has_value() && (*recordSeverity != entrySeverity))
+        {
+            updated.push_back(
+                {ChangeType::SeverityChanged, entryRecordId, record});
+        }
+
+        if (record.elogId != entryErrLogId)
+        {
+            updated.push_back(
+                {ChangeType::ErrorLogChanged, entryRecordId, record});
+        }
+    }
+
+    for (const auto& [entityPathRawData, entityRecords] : validRecords)
+    {
+        if (entriesEntityPath.contains(entityPathRawData))
+        {
+            continue;
+        }
+
+        // Only one entry is allowed for the same hardware
+        const auto& record = *(entityRecords.front());
+        added.push_back({ChangeType::Added, record.recordId, record});
+    }
+
+    ChangeSet changeSet;
+    changeSet.reserve(removed.size() + updated.size() + added.size());
+    std::ranges::move(removed, std::back_inserter(changeSet));
+    std::ranges::move(updated, std::back_inserter(changeSet));
+    std::ranges::move(added, std::back_inserter(changeSet));
+
+    return changeSet;
+}
+
+} // namespace diff
+} // namespace record
+} // namespace hw_isolation
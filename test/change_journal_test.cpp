@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/change_journal.hpp"
+
+#include <sdbusplus/test/sdbus_mock.hpp>
+
+#include <chrono>
+#include <thread>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+namespace hw_isolation
+{
+namespace journal
+{
+
+constexpr auto JournalObjPath = "/xyz/openbmc_project/hardware_isolation";
+
+class ChangeJournalTest : public ::testing::Test
+{
+  protected:
+    static sdbusplus::message::object_path getObjPath(const uint32_t id)
+    {
+        return sdbusplus::message::object_path(
+                   "/xyz/openbmc_project/hardware_isolation/entry") /
+               std::to_string(id);
+    }
+
+    static std::vector<Generation> getGenerations(const Changes& changes)
+    {
+        std::vector<Generation> generations;
+        for (const auto& change : std::get<2>(changes))
+        {
+            generations.emplace_back(std::get<0>(change));
+        }
+        return generations;
+    }
+
+    testing::NiceMock<sdbusplus::SdBusMock> _sdbusMock;
+    sdbusplus::bus::bus _bus{sdbusplus::get_mocked_new(&_sdbusMock)};
+};
+
+TEST_F(ChangeJournalTest, ChangesSinceGeneration)
+{
+    ChangeJournal changeJournal(_bus, JournalObjPath, 4);
+    auto start = changeJournal.generation();
+    changeJournal.add(ChangeType::EntryAdded, getObjPath(1));
+    changeJournal.add(ChangeType::EntryAdded, getObjPath(2));
+    changeJournal.add(ChangeType::EntryRemoved, getObjPath(1));
+
+    auto changes = changeJournal.getChangesSince(start + 1);
+    EXPECT_FALSE(std::get<0>(changes));
+    EXPECT_EQ(std::get<1>(changes), start + 3);
+    EXPECT_EQ(getGenerations(changes),
+              (std::vector<Generation>{start + 2, start + 3}));
+
+    auto lastChange = std::get<2>(changes).back();
+    EXPECT_EQ(std::get<1>(lastChange), ChangeType::EntryRemoved);
+    EXPECT_EQ(std::get<2>(lastChange), getObjPath(1));
+
+    // The start generation gets all the changes
+    changes = changeJournal.getChangesSince(start);
+    EXPECT_FALSE(std::get<0>(changes));
+    EXPECT_EQ(std::get<2>(changes).size(), 3);
+
+    // The latest generation has nothing to get
+    changes = changeJournal.getChangesSince(start + 3);
+    EXPECT_FALSE(std::get<0>(changes));
+    EXPECT_TRUE(std::get<2>(changes).empty());
+}
+
+TEST_F(ChangeJournalTest, DroppedGenerationRequiresResync)
+{
+    ChangeJournal changeJournal(_bus, JournalObjPath, 2);
+    auto start = changeJournal.generation();
+    for (uint32_t id = 1; id <= 4; ++id)
+    {
+        changeJournal.add(ChangeType::EntryAdded, getObjPath(id));
+    }
+
+    // The changes of the generations 1 and 2 are dropped so, the changes
+    // after the generation 2 are still available.
+    EXPECT_TRUE(std::get<0>(changeJournal.getChangesSince(start + 1)));
+
+    auto changes = changeJournal.getChangesSince(start + 2);
+    EXPECT_FALSE(std::get<0>(changes));
+    EXPECT_EQ(getGenerations(changes),
+              (std::vector<Generation>{start + 3, start + 4}));
+}
+
+TEST_F(ChangeJournalTest, FutureGenerationRequiresResync)
+{
+    ChangeJournal changeJournal(_bus, JournalObjPath, 4);
+    auto start = changeJournal.generation();
+    changeJournal.add(ChangeType::EntryAdded, getObjPath(1));
+
+    auto changes = changeJournal.getChangesSince(start + 2);
+    EXPECT_TRUE(std::get<0>(changes));
+    EXPECT_EQ(std::get<1>(changes), start + 1);
+    EXPECT_TRUE(std::get<2>(changes).empty());
+}
+
+TEST_F(ChangeJournalTest, ResyncDropsAllChanges)
+{
+    ChangeJournal changeJournal(_bus, JournalObjPath, 4);
+    auto start = changeJournal.generation();
+    changeJournal.add(ChangeType::EntryAdded, getObjPath(1));
+    changeJournal.resync();
+
+    EXPECT_TRUE(std::get<0>(changeJournal.getChangesSince(start)));
+    EXPECT_TRUE(std::get<0>(changeJournal.getChangesSince(start + 1)));
+
+    auto changes = changeJournal.getChangesSince(start + 2);
+    EXPECT_FALSE(std::get<0>(changes));
+    EXPECT_EQ(std::get<1>(changes), start + 2);
+    EXPECT_TRUE(std::get<2>(changes).empty());
+}
+
+TEST_F(ChangeJournalTest, PreviousInstanceGenerationRequiresResync)
+{
+    Generation previousGeneration{0};
+    {
+        ChangeJournal changeJournal(_bus, JournalObjPath, 4);
+        changeJournal.add(ChangeType::EntryAdded, getObjPath(1));
+        previousGeneration = changeJournal.generation();
+    }
+
+    // The restarted journal gets more changes than the previous instance
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ChangeJournal changeJournal(_bus, JournalObjPath, 4);
+    changeJournal.add(ChangeType::EntryAdded, getObjPath(2));
+    changeJournal.add(ChangeType::EntryAdded, getObjPath(3));
+
+    EXPECT_GT(changeJournal.generation(), previousGeneration);
+    EXPECT_TRUE(
+        std::get<0>(changeJournal.getChangesSince(previousGeneration)));
+}
+
+} // namespace journal
+} // namespace hw_isolation
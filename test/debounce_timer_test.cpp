@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "common/debounce_timer.hpp"
+
+#include <sdeventplus/event.hpp>
+
+#include <gtest/gtest.h>
+
+namespace hw_isolation
+{
+namespace debounce
+{
+
+using namespace std::chrono_literals;
+
+class DebounceTimerTest : public ::testing::Test
+{
+  protected:
+    /**
+     * @brief Helper function to run the event loop until the handler is
+     *        called or the given timeout is elapsed.
+     */
+    void runUntilCalled(std::chrono::milliseconds timeout)
+    {
+        auto calls = _calls;
+        auto deadline = Clock::now() + timeout;
+        while ((_calls == calls) && (Clock::now() < deadline))
+        {
+            _event.run(std::chrono::microseconds(10ms));
+        }
+    }
+
+    sdeventplus::Event _event{sdeventplus::Event::get_new()};
+    size_t _calls{0};
+};
+
+TEST_F(DebounceTimerTest, TriggersAreCoalesced)
+{
+    DebounceTimer debounceTimer(_event, 50ms, 5s, [this]() { ++_calls; });
+    debounceTimer.trigger();
+    debounceTimer.trigger();
+    debounceTimer.trigger();
+    EXPECT_TRUE(debounceTimer.isPending());
+
+    runUntilCalled(2s);
+    EXPECT_EQ(_calls, 1);
+    EXPECT_FALSE(debounceTimer.isPending());
+
+    const auto& stats = debounceTimer.getStats();
+    EXPECT_EQ(stats._lastCoalesced, 3);
+    EXPECT_EQ(stats._maxCoalesced, 3);
+    EXPECT_EQ(stats._totalTriggers, 3);
+    EXPECT_EQ(stats._totalFlushes, 1);
+    EXPECT_EQ(stats._maxLatencyFlushes, 0);
+}
+
+TEST_F(DebounceTimerTest, MaxLatencyBoundsTriggerBurst)
+{
+    DebounceTimer debounceTimer(_event, 100ms, 200ms, [this]() { ++_calls; });
+
+    // Keep triggering within the quiet period so, only the maximum latency
+    // can call the handler.
+    auto deadline = Clock::now() + 2s;
+    while ((_calls == 0) && (Clock::now() < deadline))
+    {
+        debounceTimer.trigger();
+        _event.run(std::chrono::microseconds(20ms));
+    }
+
+    EXPECT_EQ(_calls, 1);
+    EXPECT_EQ(debounceTimer.getStats()._maxLatencyFlushes, 1);
+}
+
+TEST_F(DebounceTimerTest, FlushCallsHandlerImmediately)
+{
+    DebounceTimer debounceTimer(_event, 5s, 5s, [this]() { ++_calls; });
+
+    // Nothing to flush without the pending triggers
+    debounceTimer.flush();
+    EXPECT_EQ(_calls, 0);
+
+    debounceTimer.trigger();
+    debounceTimer.flush();
+    EXPECT_EQ(_calls, 1);
+    EXPECT_FALSE(debounceTimer.isPending());
+    EXPECT_EQ(debounceTimer.getStats()._totalFlushes, 1);
+}
+
+TEST_F(DebounceTimerTest, CancelDropsPendingTriggers)
+{
+    DebounceTimer debounceTimer(_event, 50ms, 5s, [this]() { ++_calls; });
+    debounceTimer.trigger();
+    debounceTimer.cancel();
+    EXPECT_FALSE(debounceTimer.isPending());
+
+    runUntilCalled(200ms);
+    EXPECT_EQ(_calls, 0);
+    EXPECT_EQ(debounceTimer.getStats()._totalFlushes, 0);
+}
+
+} // namespace debounce
+} // namespace hw_isolation
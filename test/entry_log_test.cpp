@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hw_isolation_record/entry_log.hpp"
+
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/vector.hpp>
+#include <sdeventplus/event.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace hw_isolation
+{
+namespace record
+{
+namespace entry_log
+{
+
+class EntryLogTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/entry_log_test_XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        _dirPath = dirTemplate;
+        _logPath = _dirPath / "record_entry.log";
+        _legacyDirPath = _dirPath / "record_entry";
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(_dirPath);
+    }
+
+    static PersistedEntry getEntry(const uint8_t instance,
+                                   const uint64_t elapsed)
+    {
+        PersistedEntry entry;
+        entry._entityPath = {0x23, 0x01, 0x00, 0x02, 0x00, 0x05, instance};
+        entry._elapsed = elapsed;
+        entry._inventoryPath = "/xyz/openbmc_project/inventory/system/cpu" +
+                               std::to_string(instance);
+        entry._errLogId = 0x50000000 + instance;
+        entry._bmcErrorLogPath = "/xyz/openbmc_project/logging/entry/" +
+                                 std::to_string(instance);
+        entry._generation = 1;
+        return entry;
+    }
+
+    sdeventplus::Event _event{sdeventplus::Event::get_new()};
+    persist::WriteBehind _writeBehind{_event, std::chrono::milliseconds(1000)};
+    fs::path _dirPath;
+    fs::path _logPath;
+    fs::path _legacyDirPath;
+};
+
+/**
+ * @brief Helper function to write the given value as raw bytes
+ */
+template <typename T>
+static void writeRaw(std::ostream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * @brief Helper function to read the log format version from the header
+ */
+static uint32_t readLogVersion(const fs::path& logPath)
+{
+    std::ifstream is(logPath, std::ios::binary);
+    uint32_t magic{0};
+    uint32_t version{0};
+    is.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    is.read(reinterpret_cast<char*>(&version), sizeof(version));
+    return version;
+}
+
+TEST_F(EntryLogTest, EntriesAreReloaded)
+{
+    {
+        EntryLog entryLog(_logPath, _legacyDirPath, _writeBehind);
+        entryLog.put(1, getEntry(0, 100));
+        entryLog.put(2, getEntry(1, 200));
+        entryLog.put(3, getEntry(2, 300));
+        entryLog.erase(2);
+        _writeBehind.flush();
+    }
+
+    EntryLog entryLog(_logPath, _legacyDirPath, _writeBehind);
+    ASSERT_EQ(entryLog.getEntries().size(), 2);
+    EXPECT_EQ(entryLog.get(1), getEntry(0, 100));
+    EXPECT_FALSE(entryLog.get(2).has_value());
+    EXPECT_EQ(entryLog.get(3), getEntry(2, 300));
+}
+
+TEST_F(EntryLogTest, StaleRecordsAreCompacted)
+{
+    EntryLog entryLog(_logPath, _legacyDirPath, _writeBehind);
+    auto headerSize = fs::file_size(_logPath);
+
+    entryLog.put(1, getEntry(0, 0));
+    _writeBehind.flush();
+    auto recordSize = fs::file_size(_logPath) - headerSize;
+
+    // Write one by one to append a record per update
+    for (uint64_t elapsed = 1; elapsed <= 100; ++elapsed)
+    {
+        entryLog.put(1, getEntry(0, elapsed));
+        _writeBehind.flush();
+    }
+
+    EXPECT_LT(fs::file_size(_logPath), headerSize + (64 * recordSize));
+
+    EntryLog reloadedEntryLog(_logPath, _legacyDirPath, _writeBehind);
+    ASSERT_EQ(reloadedEntryLog.getEntries().size(), 1);
+    EXPECT_EQ(reloadedEntryLog.get(1), getEntry(0, 100));
+}
+
+TEST_F(EntryLogTest, OlderVersionIsUpgraded)
+{
+    // The version 2 record contains the ECO core flag but,
+    // not the resolved paths.
+    std::ostringstream payloadStream;
+    {
+        cereal::BinaryOutputArchive oarchive(payloadStream);
+        oarchive(static_cast<uint8_t>(1), static_cast<EntryRecordId>(7),
+                 devtree::DevTreePhysPath{0x21, 0x01, 0x00},
+                 static_cast<uint64_t>(700), true);
+    }
+    auto payload = payloadStream.str();
+
+    uint32_t checksum = 2166136261U;
+    for (const auto& byte : payload)
+    {
+        checksum ^= static_cast<uint8_t>(byte);
+        checksum *= 16777619U;
+    }
+
+    {
+        std::ofstream os(_logPath, std::ios::binary);
+        writeRaw(os, static_cast<uint32_t>(0x4857454C));
+        writeRaw(os, static_cast<uint32_t>(2));
+        writeRaw(os, static_cast<uint32_t>(payload.size()));
+        os.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+        writeRaw(os, checksum);
+    }
+
+    EntryLog entryLog(_logPath, _legacyDirPath, _writeBehind);
+    auto entry = entryLog.get(7);
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->_entityPath, (devtree::DevTreePhysPath{0x21, 0x01, 0x00}));
+    EXPECT_EQ(entry->_elapsed, 700);
+    EXPECT_TRUE(entry->_ecoCore);
+    EXPECT_TRUE(entry->_inventoryPath.empty());
+    EXPECT_EQ(entry->_generation, 0);
+
+    EXPECT_EQ(readLogVersion(_logPath), 3);
+}
+
+TEST_F(EntryLogTest, CorruptedTailIsDropped)
+{
+    {
+        EntryLog entryLog(_logPath, _legacyDirPath, _writeBehind);
+        entryLog.put(1, getEntry(0, 100));
+        _writeBehind.flush();
+    }
+    auto logSize = fs::file_size(_logPath);
+
+    {
+        std::ofstream os(_logPath, std::ios::binary | std::ios::app);
+        writeRaw(os, static_cast<uint32_t>(0xFFFFFFFF));
+    }
+
+    EntryLog entryLog(_logPath, _legacyDirPath, _writeBehind);
+    EXPECT_EQ(entryLog.get(1), getEntry(0, 100));
+    EXPECT_EQ(fs::file_size(_logPath), logSize);
+}
+
+TEST_F(EntryLogTest, UnsupportedLogIsKeptAside)
+{
+    {
+        std::ofstream os(_logPath, std::ios::binary);
+        writeRaw(os, static_cast<uint32_t>(0x4857454C));
+        writeRaw(os, static_cast<uint32_t>(99));
+        os << "newer version records";
+    }
+    auto logSize = fs::file_size(_logPath);
+
+    {
+        EntryLog entryLog(_logPath, _legacyDirPath, _writeBehind);
+        EXPECT_TRUE(entryLog.getEntries().empty());
+        entryLog.put(1, getEntry(0, 100));
+        _writeBehind.flush();
+    }
+
+    auto asidePath = fs::path(_logPath).concat(".unsupported");
+    ASSERT_TRUE(fs::exists(asidePath));
+    EXPECT_EQ(fs::file_size(asidePath), logSize);
+    EXPECT_EQ(readLogVersion(asidePath), 99);
+
+    EntryLog entryLog(_logPath, _legacyDirPath, _writeBehind);
+    EXPECT_EQ(entryLog.get(1), getEntry(0, 100));
+}
+
+TEST_F(EntryLogTest, OnlyImportedLegacyFilesAreRemoved)
+{
+    fs::create_directories(_legacyDirPath);
+    {
+        std::ofstream os(_legacyDirPath / "5", std::ios::binary);
+        cereal::BinaryOutputArchive oarchive(os);
+        oarchive(static_cast<uint32_t>(1),
+                 devtree::DevTreePhysPath{0x21, 0x01, 0x00},
+                 static_cast<uint64_t>(500));
+    }
+    {
+        std::ofstream os(_legacyDirPath / "6", std::ios::binary);
+        os << "corrupted";
+    }
+
+    EntryLog entryLog(_logPath, _legacyDirPath, _writeBehind);
+    EXPECT_TRUE(entryLog.get(5).has_value());
+    EXPECT_FALSE(entryLog.get(6).has_value());
+
+    EXPECT_FALSE(fs::exists(_legacyDirPath / "5"));
+    EXPECT_TRUE(fs::exists(_legacyDirPath / "6"));
+}
+
+} // namespace entry_log
+} // namespace record
+} // namespace hw_isolation
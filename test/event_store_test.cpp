@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hw_isolation_event/event_store.hpp"
+
+#include <sdeventplus/event.hpp>
+
+#include <cstdlib>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+namespace hw_isolation
+{
+namespace event
+{
+namespace event_store
+{
+
+class EventStoreTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/event_store_test_XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        _dirPath = dirTemplate;
+        _storePath = _dirPath / "hw_status.store";
+        _legacyDirPath = _dirPath / "event";
+    }
+
+    void TearDown() override
+    {
+        fs::remove_all(_dirPath);
+    }
+
+    static PersistedEvent getEvent(const EventSeverity severity,
+                                   const uint64_t timestamp)
+    {
+        return PersistedEvent{severity, timestamp, "Test event",
+                              "/xyz/openbmc_project/inventory/system/cpu0",
+                              "/xyz/openbmc_project/logging/entry/1"};
+    }
+
+    sdeventplus::Event _event{sdeventplus::Event::get_new()};
+    persist::WriteBehind _writeBehind{_event, std::chrono::milliseconds(1000)};
+    fs::path _dirPath;
+    fs::path _storePath;
+    fs::path _legacyDirPath;
+};
+
+TEST_F(EventStoreTest, OkEventsAreEvictedFirst)
+{
+    EventStore eventStore(_storePath, _legacyDirPath, 3, _writeBehind);
+    EXPECT_FALSE(
+        eventStore.put(1, getEvent(EventSeverity::Critical, 1)).has_value());
+    EXPECT_FALSE(eventStore.put(2, getEvent(EventSeverity::Ok, 2)).has_value());
+    EXPECT_FALSE(
+        eventStore.put(3, getEvent(EventSeverity::Warning, 3)).has_value());
+
+    EXPECT_EQ(eventStore.put(4, getEvent(EventSeverity::Critical, 4)), 2);
+
+    // No Ok severity events so, the oldest event is evicted
+    EXPECT_EQ(eventStore.put(5, getEvent(EventSeverity::Critical, 5)), 1);
+
+    EXPECT_EQ(eventStore.getEvents().size(), 3);
+    EXPECT_EQ(eventStore.getNumOfEvictedEvents(), 2);
+}
+
+TEST_F(EventStoreTest, PutEventIsNotEvicted)
+{
+    EventStore eventStore(_storePath, _legacyDirPath, 2, _writeBehind);
+    eventStore.put(1, getEvent(EventSeverity::Critical, 1));
+    eventStore.put(2, getEvent(EventSeverity::Critical, 2));
+
+    // The new Ok severity event is kept even though it is the only
+    // Ok severity event in the store.
+    EXPECT_EQ(eventStore.put(3, getEvent(EventSeverity::Ok, 3)), 1);
+    EXPECT_TRUE(eventStore.getEvents().contains(3));
+}
+
+TEST_F(EventStoreTest, EventsAreReloaded)
+{
+    EventId lastEventId{0};
+    {
+        EventStore eventStore(_storePath, _legacyDirPath, 3, _writeBehind);
+        lastEventId = eventStore.allocateEventId();
+        eventStore.put(lastEventId, getEvent(EventSeverity::Warning, 1));
+        _writeBehind.flush();
+    }
+
+    EventStore eventStore(_storePath, _legacyDirPath, 3, _writeBehind);
+    ASSERT_EQ(eventStore.getEvents().size(), 1);
+
+    const auto& event = eventStore.getEvents().at(lastEventId);
+    EXPECT_EQ(event._severity, EventSeverity::Warning);
+    EXPECT_EQ(event._timestamp, 1);
+    EXPECT_EQ(event._message, "Test event");
+
+    // The event ids are not reused after the reload
+    EXPECT_GT(eventStore.allocateEventId(), lastEventId);
+}
+
+TEST_F(EventStoreTest, ExceededEventsAreDroppedOnReload)
+{
+    {
+        EventStore eventStore(_storePath, _legacyDirPath, 3, _writeBehind);
+        eventStore.put(1, getEvent(EventSeverity::Critical, 1));
+        eventStore.put(2, getEvent(EventSeverity::Critical, 2));
+        eventStore.put(3, getEvent(EventSeverity::Critical, 3));
+        _writeBehind.flush();
+    }
+
+    EventStore eventStore(_storePath, _legacyDirPath, 2, _writeBehind);
+    ASSERT_EQ(eventStore.getEvents().size(), 2);
+    EXPECT_FALSE(eventStore.getEvents().contains(1));
+}
+
+TEST_F(EventStoreTest, UnsupportedStoreIsKeptAside)
+{
+    // The unsupported version header followed by the event id counter
+    {
+        std::ofstream os(_storePath, std::ios::binary);
+        uint32_t header[] = {0x48574553, 99, 41};
+        os.write(reinterpret_cast<const char*>(header), sizeof(header));
+        os << "newer version events";
+    }
+    auto storeSize = fs::file_size(_storePath);
+
+    EventStore eventStore(_storePath, _legacyDirPath, 3, _writeBehind);
+    EXPECT_TRUE(eventStore.getEvents().empty());
+
+    auto asidePath = fs::path(_storePath).concat(".unsupported");
+    ASSERT_TRUE(fs::exists(asidePath));
+    EXPECT_EQ(fs::file_size(asidePath), storeSize);
+
+    // The event ids are not reused after dropping the unsupported store
+    EXPECT_GT(eventStore.allocateEventId(), 41);
+}
+
+} // namespace event_store
+} // namespace event
+} // namespace hw_isolation
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include "hw_isolation_record/record_diff.hpp"
+
+#include <gtest/gtest.h>
+
+namespace hw_isolation
+{
+namespace record
+{
+namespace diff
+{
+
+using openpower_guard::GardType;
+using openpower_guard::GuardRecord;
+using openpower_guard::GuardRecords;
+
+/**
+ * @brief The physical path raw data of the test hardware i.e. the path type
+ *        and the number of elements, and then the elements.
+ */
+static devtree::DevTreePhysPath getPhysPath(const uint8_t instance)
+{
+    return {0x23, 0x01, 0x00, 0x02, 0x00, 0x05, instance};
+}
+
+static GuardRecord getRecord(const entry::EntryRecordId recordId,
+                             const uint8_t instance, const uint32_t elogId,
+                             const GardType guardType)
+{
+    auto physPath = getPhysPath(instance);
+
+    GuardRecord record{};
+    record.recordId = recordId;
+    record.targetId = openpower_guard::EntityPath(physPath.data(),
+                                                  physPath.size());
+    record.elogId = elogId;
+    record.errType = guardType;
+    return record;
+}
+
+TEST(RecordDiffTest, NoChangesIfEntriesReflectRecords)
+{
+    EntryStates entryStates{
+        {1, getPhysPath(0), entry::EntrySeverity::Critical, 100},
+        {2, getPhysPath(1), entry::EntrySeverity::Warning, 200}};
+    GuardRecords records{getRecord(1, 0, 100, GardType::GARD_Fatal),
+                         getRecord(2, 1, 200, GardType::GARD_Predictive)};
+
+    EXPECT_TRUE(computeChangeSet(entryStates, records).empty());
+}
+
+TEST(RecordDiffTest, InvalidRecordsAreIgnored)
+{
+    EntryStates entryStates{
+        {1, getPhysPath(0), entry::EntrySeverity::Critical, 100}};
+    GuardRecords records{getRecord(1, 0, 100, GardType::GARD_Fatal),
+                         getRecord(0xFFFFFFFF, 1, 200, GardType::GARD_Fatal)};
+
+    EXPECT_TRUE(computeChangeSet(entryStates, records).empty());
+}
+
+TEST(RecordDiffTest, ChangesAreOrderedToApply)
+{
+    EntryStates entryStates{
+        {1, getPhysPath(0), entry::EntrySeverity::Critical, 100},
+        {2, getPhysPath(1), entry::EntrySeverity::Warning, 200},
+        {3, getPhysPath(2), entry::EntrySeverity::Warning, 300}};
+
+    // The record 1 is removed, the record 2 is updated and, the record 4
+    // is added. The record 3 is unchanged.
+    GuardRecords records{getRecord(4, 3, 400, GardType::GARD_Fatal),
+                         getRecord(2, 1, 201, GardType::GARD_Fatal),
+                         getRecord(3, 2, 300, GardType::GARD_Predictive)};
+
+    auto changeSet = computeChangeSet(entryStates, records);
+    ASSERT_EQ(changeSet.size(), 4);
+
+    EXPECT_EQ(changeSet[0]._type, ChangeType::Removed);
+    EXPECT_EQ(changeSet[0]._entryRecordId, 1);
+    EXPECT_FALSE(changeSet[0]._record.has_value());
+
+    EXPECT_EQ(changeSet[1]._type, ChangeType::SeverityChanged);
+    EXPECT_EQ(changeSet[1]._entryRecordId, 2);
+    EXPECT_EQ(changeSet[2]._type, ChangeType::ErrorLogChanged);
+    EXPECT_EQ(changeSet[2]._entryRecordId, 2);
+    ASSERT_TRUE(changeSet[2]._record.has_value());
+    EXPECT_EQ(changeSet[2]._record->elogId, 201);
+
+    EXPECT_EQ(changeSet[3]._type, ChangeType::Added);
+    EXPECT_EQ(changeSet[3]._entryRecordId, 4);
+}
+
+TEST(RecordDiffTest, RecreatedRecordReplacesEntry)
+{
+    EntryStates entryStates{
+        {1, getPhysPath(0), entry::EntrySeverity::Critical, 100}};
+    GuardRecords records{getRecord(5, 0, 100, GardType::GARD_Fatal)};
+
+    auto changeSet = computeChangeSet(entryStates, records);
+    ASSERT_EQ(changeSet.size(), 2);
+
+    EXPECT_EQ(changeSet[0]._type, ChangeType::Removed);
+    EXPECT_EQ(changeSet[0]._entryRecordId, 1);
+    EXPECT_EQ(changeSet[1]._type, ChangeType::Added);
+    EXPECT_EQ(changeSet[1]._entryRecordId, 5);
+}
+
+} // namespace diff
+} // namespace record
+} // namespace hw_isolation